@@ -0,0 +1,186 @@
+//
+// render_count_bench.cpp - partial render benchmark
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+// Counts the widgets that on_render draws in a frame, the number that RENDERCOUNT logs, for a
+// caret blink and for hover changes on a scrolled page of synthetic widgets. Each frame is
+// counted as a full render, which is what every frame was before partial renders, and as a
+// partial render through dirty_area and widget_needs_render, which on_render uses. Then checks
+// on random dirty rects that a partial render draws every widget that a dirty rect touches and
+// that the clip contains every dirty rect.
+// Built by render_count_bench.vcxproj, which is not part of lecui.sln, so it is never built
+// with the library.
+
+#include "../form_common.h"
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace liblec::lecui;
+
+namespace {
+	constexpr int bench_columns = 10;			// the widgets are laid out in a grid of this many columns
+	constexpr int bench_rows = 100;				// and this many rows
+	constexpr float bench_width = 90.f;			// the size of a widget, in DIPs
+	constexpr float bench_height = 30.f;
+	constexpr float bench_pitch_x = 100.f;		// the distance between the widgets' top left corners, in DIPs
+	constexpr float bench_pitch_y = 40.f;
+	constexpr D2D1_RECT_F bench_visible = { 10.f, 50.f, 810.f, 650.f };	// the part of the page that can be seen
+	constexpr float bench_scroll = 1000.f;		// how far the page is scrolled down, in DIPs
+	constexpr int bench_frames = 100000;		// the number of random frames to check
+
+	struct frame {
+		std::string name;
+		std::vector<D2D1_RECT_F> dirty_rects;
+	};
+
+	D2D1_RECT_F widget_rect(int column, int row) {
+		const float left = bench_visible.left + column * bench_pitch_x;
+		const float top = bench_visible.top + row * bench_pitch_y - bench_scroll;
+		return { left, top, left + bench_width, top + bench_height };
+	}
+
+	std::vector<D2D1_RECT_F> page() {
+		std::vector<D2D1_RECT_F> widgets;
+
+		for (int row = 0; row < bench_rows; row++)
+			for (int column = 0; column < bench_columns; column++)
+				widgets.push_back(widget_rect(column, row));
+
+		return widgets;
+	}
+
+	/// The frames an application typically draws between full renders, with the rects that the
+	/// widgets report through widget_impl::invalidate.
+	std::vector<frame> frames() {
+		// the widgets in view are those in rows 25 to 39
+		const auto text_field = widget_rect(2, 30);
+		const D2D1_RECT_F caret = { text_field.left + 20.f, text_field.top + 7.f,
+			text_field.left + 21.f, text_field.bottom - 7.f };
+
+		return {
+			{ "caret blink", { caret } },
+			{ "hover on a widget", { widget_rect(4, 30) } },
+			{ "hover to the next widget", { widget_rect(4, 30), widget_rect(5, 30) } },
+			{ "hover across the page", { widget_rect(0, 26), widget_rect(7, 38) } },
+		};
+	}
+
+	struct count {
+		unsigned long drawn = 0;
+		unsigned long culled = 0;
+	};
+
+	/// Count the widgets drawn and culled in a frame, the way on_render's needs_render does.
+	count render(const std::vector<D2D1_RECT_F>& widgets, const D2D1_RECT_F* p_dirty_area,
+		std::vector<bool>* p_drawn = nullptr) {
+		count c;
+
+		if (p_drawn)
+			p_drawn->assign(widgets.size(), false);
+
+		for (size_t i = 0; i < widgets.size(); i++) {
+			bool culled = false;
+
+			if (widget_needs_render(widgets[i], &bench_visible, p_dirty_area, culled)) {
+				c.drawn++;
+
+				if (p_drawn)
+					(*p_drawn)[i] = true;
+			}
+
+			if (culled)
+				c.culled++;
+		}
+
+		return c;
+	}
+
+	bool contains(const D2D1_RECT_F& outer, const D2D1_RECT_F& inner) {
+		return outer.left <= inner.left && outer.top <= inner.top &&
+			outer.right >= inner.right && outer.bottom >= inner.bottom;
+	}
+
+	/// Check a partial render of random dirty rects against the rects themselves.
+	bool check(const std::vector<D2D1_RECT_F>& widgets, std::mt19937& generator) {
+		std::uniform_real_distribution<float> x(bench_visible.left - 50.f, bench_visible.right + 50.f);
+		std::uniform_real_distribution<float> y(bench_visible.top - 50.f, bench_visible.bottom + 50.f);
+		std::uniform_real_distribution<float> size(0.5f, 120.f);
+		std::uniform_int_distribution<int> rects(1, 3);
+		const float scales[] = { 1.f, 1.25f, 1.5f, 1.75f, 2.f };
+		std::uniform_int_distribution<int> scale(0, 4);
+
+		std::vector<D2D1_RECT_F> dirty_rects;
+
+		for (int i = rects(generator); i > 0; i--) {
+			const float left = x(generator), top = y(generator);
+			dirty_rects.push_back({ left, top, left + size(generator), top + size(generator) });
+		}
+
+		const auto area = dirty_area(dirty_rects, nullptr, scales[scale(generator)]);
+
+		for (const auto& rect : dirty_rects)
+			if (!contains(area, rect))
+				return false;
+
+		std::vector<bool> drawn;
+		render(widgets, &area, &drawn);
+
+		for (size_t i = 0; i < widgets.size(); i++) {
+			bool culled = false;
+
+			if (!widget_needs_render(widgets[i], &bench_visible, nullptr, culled))
+				continue;
+
+			for (const auto& rect : dirty_rects)
+				if (overlap(widgets[i], rect) && !drawn[i])
+					return false;
+		}
+
+		return true;
+	}
+}
+
+int main() {
+	const auto widgets = page();
+
+	std::cout << widgets.size() << " widgets, widgets drawn in a frame" << std::endl;
+	std::cout << std::left << std::setw(28) << "frame" << std::right << std::setw(8) << "scale"
+		<< std::setw(8) << "full" << std::setw(10) << "partial" << std::setw(8) << "culled"
+		<< std::setw(22) << "clip, in DIPs" << std::endl;
+
+	const auto full = render(widgets, nullptr);
+
+	for (const auto& f : frames()) {
+		for (const float scale : { 1.f, 1.5f }) {
+			const auto area = dirty_area(f.dirty_rects, nullptr, scale);
+			const auto partial = render(widgets, &area);
+
+			std::cout << std::left << std::setw(28) << f.name << std::right << std::fixed << std::setprecision(2)
+				<< std::setw(8) << scale << std::setw(8) << full.drawn << std::setw(10) << partial.drawn
+				<< std::setw(8) << partial.culled << std::setprecision(1) << std::setw(14) << area.right - area.left
+				<< " x " << std::setw(5) << area.bottom - area.top << std::endl;
+		}
+	}
+
+	std::mt19937 generator(2019);
+
+	for (int i = 0; i < bench_frames; i++) {
+		if (!check(widgets, generator)) {
+			std::cout << "mismatch: a partial render missed a dirty rect" << std::endl;
+			return 1;
+		}
+	}
+
+	std::cout << bench_frames << " random partial renders drew every widget their dirty rects touch" << std::endl;
+	return 0;
+}
@@ -0,0 +1,198 @@
+//
+// table_selection_bench.cpp - table view selection benchmark
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+// Times the selection checks that table_view_impl::render makes for the rows it draws, against
+// the size of the selection: once with row_ranges, as the table does now, and once with
+// std::find over the list of selected rows, as it used to. Then checks that row_ranges agrees
+// with a std::set of rows over random sequences of the edits the table makes.
+// Built by table_selection_bench.vcxproj, which is not part of lecui.sln, so it is never built
+// with the library. Run the release build; the debug build's timings mean little.
+
+#include "../widgets/table_view/row_ranges.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr long bench_visible_rows = 40;		// the rows drawn in a frame
+	constexpr int bench_frames = 200;			// the frames timed for each selection
+	constexpr int bench_sequences = 2000;		// the random edit sequences compared with std::set
+	constexpr int bench_edits = 200;			// the edits in each sequence
+
+	struct selection {
+		std::string name;
+		std::vector<long> rows;
+	};
+
+	/// The selections to time on a table with the given number of rows.
+	std::vector<selection> selections(const long& rows) {
+		std::vector<selection> result;
+
+		selection one{ "one row", { rows / 2 } };
+		result.push_back(one);
+
+		selection half{ "first half", {} };
+		for (long row = 0; row < rows / 2; row++)
+			half.rows.push_back(row);
+		result.push_back(half);
+
+		selection all{ "all rows", {} };
+		for (long row = 0; row < rows; row++)
+			all.rows.push_back(row);
+		result.push_back(all);
+
+		selection alternate{ "every other row", {} };
+		for (long row = 0; row < rows; row += 2)
+			alternate.rows.push_back(row);
+		result.push_back(alternate);
+
+		return result;
+	}
+
+	/// The time taken to check the visible rows of bench_frames frames, scrolled through the
+	/// table, in microseconds per frame.
+	template <typename function>
+	double per_frame(const long& rows, size_t& hits, const function& contains) {
+		using clock = std::chrono::steady_clock;
+		const long step = std::max(1L, (rows - bench_visible_rows) / bench_frames);
+
+		const auto start = clock::now();
+
+		for (int frame = 0; frame < bench_frames; frame++) {
+			const long first = std::min(frame * step, std::max(0L, rows - bench_visible_rows));
+
+			for (long row = first; row < first + bench_visible_rows && row < rows; row++)
+				if (contains(row))
+					hits++;
+		}
+
+		return std::chrono::duration<double, std::micro>(clock::now() - start).count() / bench_frames;
+	}
+
+	/// Apply random edits, the way the table's clicks do, to row_ranges and to a std::set.
+	bool compare_with_set(std::mt19937& generator) {
+		const long rows = 100;
+		std::uniform_int_distribution<long> row(0, rows - 1);
+		std::uniform_int_distribution<int> edit(0, 9);
+
+		std::vector<row_ranges::range> ranges;
+		row_ranges selected(ranges);
+		std::set<long> reference;
+
+		for (int i = 0; i < bench_edits; i++) {
+			switch (edit(generator)) {
+			case 0: {
+				// replace the selection, e.g. through table_view::selected()
+				std::vector<long> list;
+				const auto count = row(generator) / 10;
+
+				for (long j = 0; j < count; j++)
+					list.push_back(row(generator));
+
+				selected.assign(list);
+				reference = std::set<long>(list.begin(), list.end());
+			} break;
+			case 1:
+				selected.clear();
+				reference.clear();
+				break;
+			case 2:
+			case 3:
+			case 4: {
+				// shift-click
+				const auto first = row(generator), last = row(generator);
+				selected.add(first, last);
+
+				for (long r = std::min(first, last); r <= std::max(first, last); r++)
+					reference.insert(r);
+			} break;
+			default: {
+				// ctrl-click
+				const auto r = row(generator);
+
+				if (selected.contains(r))
+					selected.remove(r);
+				else
+					selected.add(r, r);
+
+				if (!reference.erase(r))
+					reference.insert(r);
+			} break;
+			}
+
+			std::vector<long> list;
+			selected.get(list);
+
+			if (list != std::vector<long>(reference.begin(), reference.end()) ||
+				selected.count() != reference.size() || selected.empty() != reference.empty())
+				return false;
+
+			// the ranges are sorted and neither overlap nor touch
+			for (size_t j = 1; j < ranges.size(); j++)
+				if (ranges[j].first <= ranges[j - 1].second + 1)
+					return false;
+		}
+
+		return true;
+	}
+}
+
+int main() {
+	std::cout << "selection checks for " << bench_visible_rows << " rows per frame, in microseconds" << std::endl;
+	std::cout << std::left << std::setw(10) << "rows" << std::setw(18) << "selection" << std::right
+		<< std::setw(12) << "selected" << std::setw(10) << "ranges" << std::setw(14) << "std::find"
+		<< std::setw(14) << "row_ranges" << std::endl;
+
+	for (const long rows : { 1000L, 100000L, 500000L }) {
+		for (const auto& s : selections(rows)) {
+			std::vector<row_ranges::range> ranges;
+			row_ranges selected(ranges);
+			selected.assign(s.rows);
+
+			size_t find_hits = 0, range_hits = 0;
+
+			const auto find_time = per_frame(rows, find_hits, [&](const long& row) {
+				return std::find(s.rows.begin(), s.rows.end(), row) != s.rows.end();
+			});
+
+			const auto range_time = per_frame(rows, range_hits, [&](const long& row) {
+				return selected.contains(row);
+			});
+
+			std::cout << std::left << std::setw(10) << rows << std::setw(18) << s.name << std::right
+				<< std::setw(12) << s.rows.size() << std::setw(10) << ranges.size() << std::fixed
+				<< std::setprecision(2) << std::setw(14) << find_time << std::setw(14) << range_time << std::endl;
+
+			if (find_hits != range_hits) {
+				std::cout << "mismatch: std::find found " << find_hits << " selected rows, row_ranges found "
+					<< range_hits << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	std::mt19937 generator(2019);
+
+	for (int i = 0; i < bench_sequences; i++) {
+		if (!compare_with_set(generator)) {
+			std::cout << "mismatch: row_ranges and std::set differ after random edits" << std::endl;
+			return 1;
+		}
+	}
+
+	std::cout << bench_sequences << " random edit sequences gave the same rows as std::set" << std::endl;
+	return 0;
+}
@@ -0,0 +1,195 @@
+//
+// widget_grid_bench.cpp - widget grid hit-test benchmark
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+// Places 10,000 synthetic widgets in a widget_grid and reports how long it takes to find the
+// widgets under the mouse, compared with visiting every widget the way client_hittest used to.
+// Built by widget_grid_bench.vcxproj, which is not part of lecui.sln, so it is never built with
+// the library. Run the release build; the debug build's timings mean little.
+
+#include "../containers/page/widget_grid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace liblec::lecui;
+
+namespace {
+	constexpr int bench_columns = 100;			// the widgets are laid out in a grid of this many columns
+	constexpr int bench_rows = 100;				// and this many rows
+	constexpr float bench_width = 90.f;			// the size of a widget, in DIPs
+	constexpr float bench_height = 30.f;
+	constexpr float bench_pitch_x = 100.f;		// the distance between the widgets' top left corners, in DIPs
+	constexpr float bench_pitch_y = 40.f;
+	constexpr int bench_points = 100000;		// the number of mouse positions to hit-test
+	constexpr int bench_moves = 100;			// the number of times the widgets are scrolled
+
+	/// The grid only keeps pointers to the widgets and never calls them, so a synthetic widget
+	/// is a rect whose address stands in for a widget_impl.
+	struct synthetic_widget {
+		D2D1_RECT_F rect = { 0.f, 0.f, 0.f, 0.f };
+	};
+
+	widgets::widget_impl* as_widget(synthetic_widget& widget) {
+		return reinterpret_cast<widgets::widget_impl*>(&widget);
+	}
+
+	const synthetic_widget& as_synthetic(widgets::widget_impl* p_widget) {
+		return *reinterpret_cast<const synthetic_widget*>(p_widget);
+	}
+
+	bool contains(const D2D1_RECT_F& rect, const D2D1_POINT_2F& point) {
+		return point.x >= rect.left && point.x <= rect.right &&
+			point.y >= rect.top && point.y <= rect.bottom;
+	}
+
+	struct latency {
+		double mean = 0.;
+		double median = 0.;
+		double p99 = 0.;
+		double max = 0.;
+	};
+
+	/// Summarize the times taken, in nanoseconds.
+	latency summarize(std::vector<double>& times) {
+		latency result;
+
+		if (times.empty())
+			return result;
+
+		std::sort(times.begin(), times.end());
+
+		double total = 0.;
+		for (const auto& time : times)
+			total += time;
+
+		result.mean = total / times.size();
+		result.median = times[times.size() / 2];
+		result.p99 = times[(times.size() * 99) / 100];
+		result.max = times.back();
+		return result;
+	}
+
+	void report(const std::string& name, const latency& l) {
+		std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(0)
+			<< "mean " << std::setw(8) << l.mean << " ns, median " << std::setw(8) << l.median
+			<< " ns, p99 " << std::setw(8) << l.p99 << " ns, max " << std::setw(10) << l.max << " ns" << std::endl;
+	}
+}
+
+int main() {
+	using clock = std::chrono::steady_clock;
+
+	// lay out the widgets, with a page-sized pane behind them like a form's background
+	std::vector<synthetic_widget> widgets(static_cast<size_t>(bench_columns) * bench_rows);
+
+	for (int row = 0; row < bench_rows; row++)
+		for (int column = 0; column < bench_columns; column++) {
+			auto& rect = widgets[static_cast<size_t>(row) * bench_columns + column].rect;
+			rect.left = column * bench_pitch_x;
+			rect.top = row * bench_pitch_y;
+			rect.right = rect.left + bench_width;
+			rect.bottom = rect.top + bench_height;
+		}
+
+	synthetic_widget background;
+	background.rect = { 0.f, 0.f, bench_columns * bench_pitch_x, bench_rows * bench_pitch_y };
+
+	// place the widgets
+	widget_grid grid;
+	auto start = clock::now();
+
+	grid.place(as_widget(background), background.rect);
+
+	for (auto& widget : widgets)
+		grid.place(as_widget(widget), widget.rect);
+
+	const auto place_time = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+	// the mouse positions
+	std::mt19937 generator(2019);
+	std::uniform_real_distribution<float> x(0.f, background.rect.right);
+	std::uniform_real_distribution<float> y(0.f, background.rect.bottom);
+
+	std::vector<D2D1_POINT_2F> points(bench_points);
+	for (auto& point : points)
+		point = { x(generator), y(generator) };
+
+	// hit-test through the grid
+	std::vector<double> grid_times;
+	grid_times.reserve(points.size());
+	std::vector<widgets::widget_impl*> candidates;
+	size_t grid_hits = 0;
+	size_t candidates_visited = 0;
+
+	for (const auto& point : points) {
+		start = clock::now();
+
+		grid.candidates(point, candidates);
+
+		for (auto p_widget : candidates)
+			if (contains(as_synthetic(p_widget).rect, point))
+				grid_hits++;
+
+		grid_times.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count());
+		candidates_visited += candidates.size();
+	}
+
+	// hit-test by visiting every widget
+	std::vector<double> linear_times;
+	linear_times.reserve(points.size());
+	size_t linear_hits = 0;
+
+	for (const auto& point : points) {
+		start = clock::now();
+
+		if (contains(background.rect, point))
+			linear_hits++;
+
+		for (const auto& widget : widgets)
+			if (contains(widget.rect, point))
+				linear_hits++;
+
+		linear_times.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count());
+	}
+
+	// scroll the widgets, which places each of them again as a render would
+	start = clock::now();
+
+	for (int move = 1; move <= bench_moves; move++)
+		for (auto& widget : widgets) {
+			D2D1_RECT_F rect = widget.rect;
+			rect.top -= move * 4.f;
+			rect.bottom -= move * 4.f;
+			grid.place(as_widget(widget), rect);
+		}
+
+	const auto move_time = std::chrono::duration<double, std::milli>(clock::now() - start).count() / bench_moves;
+
+	std::cout << widgets.size() + 1 << " widgets, " << points.size() << " hit-tests" << std::endl;
+	std::cout << std::fixed << std::setprecision(2)
+		<< "placing all widgets: " << place_time << " ms" << std::endl
+		<< "placing all widgets again after a scroll: " << move_time << " ms" << std::endl
+		<< "candidates per hit-test: " << static_cast<double>(candidates_visited) / points.size() << std::endl;
+
+	report("grid", summarize(grid_times));
+	report("linear", summarize(linear_times));
+
+	if (grid_hits != linear_hits) {
+		std::cout << "mismatch: the grid found " << grid_hits << " hits, visiting every widget found "
+			<< linear_hits << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
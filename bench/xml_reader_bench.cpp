@@ -0,0 +1,172 @@
+//
+// xml_reader_bench.cpp - xml reader scaling benchmark
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+// Reads formatted text of 1 KB up to 1 MB with xml_parser::read and reports the time taken per
+// byte, which stays flat when reading is linear in the length of the text. Besides markup like
+// the html editor's, the text is also made of nested elements and of closing tags that match
+// nothing, which are the cases that used to rescan the text or the open elements.
+// Built by xml_reader_bench.vcxproj, which is not part of lecui.sln, so it is never built with
+// the library. Run the release build; the debug build's timings mean little.
+
+#include "../xml_parser/xml_parser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr size_t bench_smallest = 1024;				// the size of the smallest text, in bytes
+	constexpr size_t bench_largest = 1024 * 1024;		// the size of the largest text, in bytes
+	constexpr int bench_repeats = 5;					// each text is read this many times, the fastest counts
+	constexpr double bench_tolerance = 3.;				// the most the time per byte may grow by
+
+	/// Markup like the html editor's: words in spans, strong, em and u, a few levels deep.
+	std::string formatted_text(size_t length, std::mt19937& generator) {
+		std::uniform_int_distribution<int> kind(0, 5);
+		std::uniform_int_distribution<int> letter('a', 'z');
+		std::string text;
+		std::vector<std::string> open;
+
+		while (text.length() < length) {
+			switch (kind(generator)) {
+			case 0:
+				if (open.size() < 4) {
+					text += "<span style='color: rgb(200, 0, 0); font-size: 11pt;'>";
+					open.push_back("span");
+				}
+				break;
+			case 1:
+				if (open.size() < 4) {
+					text += "<strong>";
+					open.push_back("strong");
+				}
+				break;
+			case 2:
+				if (!open.empty()) {
+					text += "</" + open.back() + ">";
+					open.pop_back();
+				}
+				break;
+			default:
+				for (int i = 0; i < 6; i++)
+					text += static_cast<char>(letter(generator));
+				text += ' ';
+				break;
+			}
+		}
+
+		while (!open.empty()) {
+			text += "</" + open.back() + ">";
+			open.pop_back();
+		}
+
+		return text;
+	}
+
+	/// Blocks of elements nested 64 deep. Every tag holds a copy of its contents, so the output
+	/// itself grows with the depth times the length and nesting is kept to a fixed depth.
+	std::string nested_text(size_t length, std::mt19937&) {
+		const size_t depth = 64;
+		const std::string open = "<em>a", close = "</em>";
+		std::string text;
+
+		while (text.length() < length) {
+			for (size_t i = 0; i < depth; i++)
+				text += open;
+
+			for (size_t i = 0; i < depth; i++)
+				text += close;
+		}
+
+		return text;
+	}
+
+	/// Many open elements followed by closing tags that match none of them.
+	std::string unmatched_text(size_t length, std::mt19937&) {
+		const std::string open = "<u>a", close = "</s>";
+		const auto count = length / (open.length() + close.length());
+		std::string text;
+
+		for (size_t i = 0; i < count; i++)
+			text += open;
+
+		for (size_t i = 0; i < count; i++)
+			text += close;
+
+		return text;
+	}
+
+	struct measurement {
+		size_t length = 0;
+		size_t tags = 0;
+		double ms = 0.;
+	};
+
+	/// Read texts of doubling length and report the time per byte.
+	bool bench(const std::string& name, const std::function<std::string(size_t, std::mt19937&)>& make) {
+		using clock = std::chrono::steady_clock;
+
+		std::cout << name << std::endl;
+		std::mt19937 generator(2019);
+		std::vector<measurement> measurements;
+
+		for (size_t length = bench_smallest; length <= bench_largest; length *= 2) {
+			const auto text = make(length, generator);
+			measurement m;
+			m.length = text.length();
+			m.ms = 0.;
+
+			for (int repeat = 0; repeat < bench_repeats; repeat++) {
+				const auto start = clock::now();
+				const auto info = xml_parser().read(text);
+				const auto ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+				m.tags = info.tags.size();
+				m.ms = repeat == 0 ? ms : std::min(m.ms, ms);
+			}
+
+			std::cout << std::right << std::setw(10) << m.length << " bytes, " << std::setw(7) << m.tags
+				<< " tags: " << std::fixed << std::setprecision(3) << std::setw(9) << m.ms << " ms, "
+				<< std::setprecision(2) << std::setw(6) << m.ms * 1e6 / m.length << " ns/byte" << std::endl;
+
+			measurements.push_back(m);
+		}
+
+		// compare the time per byte of the largest texts with that of the 16 KB text, below which
+		// the timings are mostly noise
+		const auto& reference = measurements[std::min<size_t>(4, measurements.size() - 1)];
+		const auto reference_per_byte = reference.ms / reference.length;
+		bool linear = true;
+
+		for (const auto& m : measurements) {
+			if (m.length > reference.length && m.ms / m.length > reference_per_byte * bench_tolerance) {
+				std::cout << "not linear: " << m.length << " bytes took " << m.ms / m.length / reference_per_byte
+					<< " times as long per byte as " << reference.length << " bytes" << std::endl;
+				linear = false;
+			}
+		}
+
+		std::cout << std::endl;
+		return linear;
+	}
+}
+
+int main() {
+	bool linear = true;
+	linear = bench("formatted text", formatted_text) && linear;
+	linear = bench("nested elements", nested_text) && linear;
+	linear = bench("unmatched closing tags", unmatched_text) && linear;
+	return linear ? 0 : 1;
+}
@@ -0,0 +1,262 @@
+//
+// xml_writer_bench.cpp - xml writer round-trip benchmark
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+// Round-trips formatted text with thousands of spans through xml_parser::read and
+// xml_parser::write and reports the time taken, then checks on 20,000 random documents that
+// write produces byte for byte what the previous, recursive writer produced.
+// Built by xml_writer_bench.vcxproj, which is not part of lecui.sln, so it is never built with
+// the library. Run the release build; the debug build's timings mean little.
+
+#include "../xml_parser/xml_parser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr size_t bench_smallest = 16 * 1024;		// the size of the smallest text, in bytes
+	constexpr size_t bench_largest = 1024 * 1024;		// the size of the largest text, in bytes
+	constexpr size_t bench_previous_largest = 64 * 1024;	// the previous writer is only timed up to this size
+	constexpr int bench_repeats = 5;					// each text is written this many times, the fastest counts
+	constexpr int bench_documents = 20000;				// the number of random documents to compare
+
+	/// The writer as it was before it was made to write in a single pass, kept to compare with.
+	namespace previous {
+		struct xml_element {
+			std::string xml;
+			size_t start = 0;
+			size_t end = 0;
+		};
+
+		std::string consolidate(std::string plain, const std::vector<xml_element>& elements) {
+			std::string xml = plain;
+
+			// loop backwards
+			for (size_t i = elements.size(); i > 0; i--) {
+				auto& element = elements[i - 1];
+
+				std::string before = xml.substr(0, element.start);
+				std::string after = xml.substr(element.end);
+
+				xml = before + element.xml + after;
+			}
+
+			return xml;
+		}
+
+		std::vector<xml_element> do_build(std::string,
+			size_t position, size_t end, long level, std::vector<xml_parser::tag> tags,
+			std::set<std::string>& handled_tags) {
+			std::vector<xml_element> elements;
+
+			for (auto& tag : tags) {
+				if (!(tag.start_position >= position && (tag.start_position + tag.length) <= end && tag.level == level))
+					continue;
+
+				const auto tag_id = tag.name + std::to_string(tag.start_position) + std::to_string(tag.start_position + tag.length);
+
+				if (!handled_tags.insert(tag_id).second)
+					continue;
+
+				// insert tags to original plain text
+				auto start_tag = tag.name;
+
+				if (!tag.attributes.empty()) {
+					// add attribute string
+					std::string attribute_string;
+
+					for (const auto& attribute : tag.attributes) {
+						if (!attribute.value.empty())
+							attribute_string += " " + attribute.name + "='" + attribute.value + "'";
+					}
+
+					start_tag += attribute_string;
+				}
+
+				start_tag = "<" + start_tag + ">";
+				auto end_tag = "</" + tag.name + ">";
+
+				for (auto sub_tag : tags) {
+					if (sub_tag.start_position >= tag.start_position && (sub_tag.start_position + sub_tag.length) <= (tag.start_position + tag.length) && sub_tag.level == tag.level + 1) {
+						// this is a direct sub tag, get it's subelements
+						auto sub_elements = do_build(tag.text, tag.start_position, (tag.start_position + tag.length), sub_tag.level, tags, handled_tags);	// recursion
+
+						for (auto& element : sub_elements) {
+							element.start -= tag.start_position;
+							element.end -= tag.start_position;
+						}
+
+						auto sub_xml = consolidate(tag.text, sub_elements);
+
+						if (sub_xml.length() != tag.text.length()) {
+							// do the replacement
+							tag.text = sub_xml;
+						}
+					}
+				}
+
+				xml_element element;
+				element.xml = start_tag + tag.text + end_tag;
+				element.start = tag.start_position;
+				element.end = tag.start_position + tag.length;
+				elements.push_back(element);
+			}
+
+			return elements;
+		}
+
+		std::string write(const xml_parser::xml& info) {
+			std::set<std::string> handled_tags;
+			const auto xml_elements = do_build(info.plain_text, 0, info.plain_text.length(), 0, info.tags, handled_tags);
+			return consolidate(info.plain_text, xml_elements);
+		}
+	}
+
+	/// Markup like the html editor's, mostly words in spans. When unbalanced is set, tags are
+	/// also opened and closed at random, leaving elements without closing tags and closing tags
+	/// without elements.
+	std::string formatted_text(size_t length, bool unbalanced, std::mt19937& generator) {
+		std::uniform_int_distribution<int> kind(0, 7);
+		std::uniform_int_distribution<int> letter('a', 'z');
+		std::uniform_int_distribution<int> coin(0, 1);
+		const std::string names[] = { "span", "strong", "em", "u" };
+		std::string text;
+		std::vector<std::string> open;
+
+		auto word = [&]() {
+			const auto letters = 1 + kind(generator) % 6;
+
+			for (int i = 0; i < letters; i++)
+				text += static_cast<char>(letter(generator));
+
+			text += ' ';
+		};
+
+		// every element begins with a word. The writer writes an element only once for each name
+		// and range, so elements with the same name and range wouldn't be written back as read
+		auto open_tag = [&](const std::string& name) {
+			if (name == "span")
+				text += coin(generator) ?
+				"<span style='color: rgb(200, 0, 0); font-size: 11pt;'>" : "<span style='font-weight: bold;'>";
+			else
+				text += "<" + name + ">";
+
+			open.push_back(name);
+			word();
+		};
+
+		while (text.length() < length) {
+			switch (kind(generator)) {
+			case 0:
+			case 1:
+				if (open.size() < 4)
+					open_tag("span");
+				break;
+			case 2:
+				if (open.size() < 4)
+					open_tag(names[1 + kind(generator) % 3]);
+				break;
+			case 3:
+			case 4:
+				if (!open.empty()) {
+					text += "</" + open.back() + ">";
+					open.pop_back();
+				}
+				break;
+			case 5:
+				if (unbalanced)
+					text += coin(generator) ? "</" + names[kind(generator) % 4] + ">" : "<" + names[kind(generator) % 4] + ">";
+				break;
+			default:
+				word();
+				break;
+			}
+		}
+
+		while (!open.empty()) {
+			if (!unbalanced || coin(generator))
+				text += "</" + open.back() + ">";
+
+			open.pop_back();
+		}
+
+		return text;
+	}
+
+	/// The fastest of bench_repeats calls, in milliseconds.
+	template <typename function>
+	double time(const function& f) {
+		using clock = std::chrono::steady_clock;
+		double fastest = 0.;
+
+		for (int repeat = 0; repeat < bench_repeats; repeat++) {
+			const auto start = clock::now();
+			f();
+			const auto ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+			fastest = repeat == 0 ? ms : std::min(fastest, ms);
+		}
+
+		return fastest;
+	}
+}
+
+int main() {
+	std::mt19937 generator(2019);
+
+	// round-trip text of increasing size
+	std::cout << "round trip" << std::endl;
+
+	for (size_t length = bench_smallest; length <= bench_largest; length *= 2) {
+		const auto text = formatted_text(length, false, generator);
+		const auto info = xml_parser().read(text);
+
+		std::string xml;
+		const auto read_ms = time([&]() { xml_parser().read(text); });
+		const auto write_ms = time([&]() { xml = xml_parser().write(info); });
+
+		std::cout << std::right << std::setw(8) << text.length() << " bytes, " << std::setw(6) << info.tags.size()
+			<< " tags: read " << std::fixed << std::setprecision(3) << std::setw(8) << read_ms << " ms, write "
+			<< std::setw(8) << write_ms << " ms";
+
+		if (text.length() <= bench_previous_largest) {
+			const auto previous_ms = time([&]() { previous::write(info); });
+			std::cout << ", previous write " << std::setw(9) << previous_ms << " ms";
+		}
+
+		std::cout << std::endl;
+
+		if (xml != text) {
+			std::cout << "mismatch: the " << text.length() << " byte text was not written back as it was read" << std::endl;
+			return 1;
+		}
+	}
+
+	// compare with the previous writer
+	std::uniform_int_distribution<size_t> length(0, 400);
+	std::uniform_int_distribution<int> coin(0, 1);
+
+	for (int i = 0; i < bench_documents; i++) {
+		const auto text = formatted_text(length(generator), coin(generator) == 1, generator);
+		const auto info = xml_parser().read(text);
+
+		if (xml_parser().write(info) != previous::write(info)) {
+			std::cout << "mismatch: the writers differ on " << text << std::endl;
+			return 1;
+		}
+	}
+
+	std::cout << bench_documents << " random documents written byte for byte as the previous writer did" << std::endl;
+	return 0;
+}
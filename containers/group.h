@@ -32,6 +32,7 @@ namespace liblec {
 				float _corner_radius_y = 5.f;
 				float _margin = 5.f;
 				std::vector<std::string> _widgets;
+				unsigned long long _widgets_generation = 0;
 
 			public:
 
@@ -257,6 +258,10 @@ namespace liblec {
 				/// calling this static method through the helper macro provided.</remarks>
 				[[nodiscard]]
 				static group& get(form& fm, const std::string& path);
+
+#if defined(LECUI_EXPORTS)
+				friend class widgets::group_impl;
+#endif
 			};
 		}
 	}
@@ -54,59 +54,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& containers::group::cursor() { return _cursor; }
+		widgets::widget::cursor_type& containers::group::cursor() { _generation++; return _cursor; }
 
 		containers::group& containers::group::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& containers::group::font() { return _font; }
+		std::string& containers::group::font() { _generation++; return _font; }
 
 		containers::group& containers::group::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& containers::group::font_size() { return _font_size; }
+		float& containers::group::font_size() { _generation++; return _font_size; }
 
 		containers::group& containers::group::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::group::color_text() { return _color_text; }
+		color& containers::group::color_text() { _generation++; return _color_text; }
 
 		containers::group& containers::group::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::group::color_fill() { return _color_fill; }
+		color& containers::group::color_fill() { _generation++; return _color_fill; }
 
 		containers::group& containers::group::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::group::color_hot() { return _color_hot; }
+		color& containers::group::color_hot() { _generation++; return _color_hot; }
 
 		containers::group& containers::group::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::group::color_selected() { return _color_selected; }
+		color& containers::group::color_selected() { _generation++; return _color_selected; }
 
 		containers::group& containers::group::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::group::color_disabled() { return _color_disabled; }
+		color& containers::group::color_disabled() { _generation++; return _color_disabled; }
 
 		containers::group& containers::group::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -117,10 +125,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& containers::group::color_border() { return _color_border; }
+		lecui::color& containers::group::color_border() { _generation++; return _color_border; }
 
 		containers::group& containers::group::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -145,10 +154,14 @@ namespace liblec {
 			return *this;
 		}
 
-		std::vector<std::string>& containers::group::widgets() { return _widgets; }
+		std::vector<std::string>& containers::group::widgets() {
+			_widgets_generation++;
+			return _widgets;
+		}
 
 		containers::group& containers::group::widgets(const std::vector<std::string>& widgets) {
 			_widgets = widgets;
+			_widgets_generation++;
 			return *this;
 		}
 
@@ -233,26 +246,12 @@ namespace liblec {
 
 		containers::group&
 			containers::group_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_group_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_group_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_group_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
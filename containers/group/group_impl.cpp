@@ -9,6 +9,7 @@
 //
 
 #include "group_impl.h"
+#include "../page/page_impl.h"
 
 namespace liblec {
 	namespace lecui {
@@ -18,7 +19,10 @@ namespace liblec {
 			_p_brush_fill(nullptr),
 			_p_brush_border(nullptr),
 			_p_brush_hot(nullptr),
-			_p_brush_disabled(nullptr) {}
+			_p_brush_disabled(nullptr),
+			_members_generation(0),
+			_page_widgets_generation(0),
+			_members_resolved(false) {}
 
 		widgets::group_impl::~group_impl() { discard_resources(); }
 
@@ -29,7 +33,6 @@ namespace liblec {
 
 		HRESULT widgets::group_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = true;
 
 			HRESULT hr = S_OK;
@@ -61,12 +64,14 @@ namespace liblec {
 
 		D2D1_RECT_F& widgets::group_impl::render(ID2D1HwndRenderTarget* p_render_target,
 			const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -95,5 +100,51 @@ namespace liblec {
 
 		containers::group&
 			widgets::group_impl::operator()() { return specs(); }
+
+		bool widgets::group_impl::fit() {
+			const auto page_widgets_generation = _page._d_page.widgets_generation();
+
+			if (!_members_resolved ||
+				_members_generation != _specs._widgets_generation ||
+				_page_widgets_generation != page_widgets_generation) {
+				_members.clear();
+
+				for (const auto& alias : _specs._widgets) {
+					auto it = _page._d_page.widgets().find(alias);
+
+					if (it != _page._d_page.widgets().end())
+						_members.push_back(&it->second);
+				}
+
+				_members_generation = _specs._widgets_generation;
+				_page_widgets_generation = page_widgets_generation;
+				_members_resolved = true;
+			}
+
+			if (_members.empty())
+				return false;
+
+			D2D1_RECT_F rect = _members.front()->get_rect();
+
+			for (auto p_member : _members) {
+				const auto& member_rect = p_member->get_rect();
+				rect.left = smallest(rect.left, member_rect.left);
+				rect.top = smallest(rect.top, member_rect.top);
+				rect.right = largest(rect.right, member_rect.right);
+				rect.bottom = largest(rect.bottom, member_rect.bottom);
+			}
+
+			// apply the margin
+			rect.left -= _specs._margin;
+			rect.top -= _specs._margin;
+			rect.right += _specs._margin;
+			rect.bottom += _specs._margin;
+
+			_specs.rect(convert_rect(rect));
+
+			// so that the group can be culled before it is rendered
+			_rect = rect;
+			return true;
+		}
 	}
 }
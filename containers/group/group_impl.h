@@ -40,6 +40,12 @@ namespace liblec {
 				containers::group& specs();
 				containers::group& operator()();
 
+				/// <summary>Fit the group's rect around the rects of its widgets.</summary>
+				/// <returns>False if none of the group's widgets exist, else true.</returns>
+				/// <remarks>The widgets are looked up by alias only when the group's list of
+				/// aliases or the widgets in the page have changed.</remarks>
+				bool fit();
+
 			private:
 				// Default constructor and copying an object of this class are not allowed
 				group_impl() = delete;
@@ -47,11 +53,16 @@ namespace liblec {
 				group_impl& operator=(const group_impl&) = delete;
 
 				/// Private variables
-				containers::group _specs, _specs_old;
+				containers::group _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_border;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
+
+				std::vector<widget_impl*> _members;
+				unsigned long long _members_generation;	// of the group's list of aliases
+				unsigned long long _page_widgets_generation;
+				bool _members_resolved;
 			};
 		}
 	}
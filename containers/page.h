@@ -124,6 +124,7 @@ namespace liblec {
 				friend class widgets::icon_impl;
 				friend class widgets::pane_impl;
 				friend class widgets::tab_pane_impl;
+				friend class widgets::group_impl;
 #endif
 			};
 		}
@@ -186,6 +186,7 @@ namespace liblec {
 			catch (const std::exception&) {}
 
 			_d._fm._d._current_page = alias;
+			_d._fm._d._special_pane_moves_pending = true;	// the special panes are made per page as it is shown
 
 			if (IsWindow(_d._fm._d._hWnd))
 				_d._fm._d.update();
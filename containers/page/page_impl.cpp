@@ -23,6 +23,7 @@ namespace liblec {
 			_hit(false),
 			_scrollbar_set(false),
 			_rendered(false),
+			_widgets_generation(0),
 			_h_scrollbar(pg),
 			_v_scrollbar(pg) {
 			_widgets.emplace(_h_scrollbar.alias(), _h_scrollbar);
@@ -130,6 +131,7 @@ namespace liblec {
 			if (_tab_panes.try_emplace(alias, _pg, alias, content_margin, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _tab_panes.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_tab_panes.at(alias).specs().alias(alias);
 			return _tab_panes.at(alias).specs();
@@ -141,6 +143,7 @@ namespace liblec {
 			if (_panes.try_emplace(alias, _pg, alias, content_margin, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _panes.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_panes.at(alias).specs().alias(alias);
 			return _panes.at(alias)._p_panes.at(_panes.at(alias)._current_pane);
@@ -152,6 +155,7 @@ namespace liblec {
 			if (_rectangles.try_emplace(alias, _pg, alias, _h_scrollbar, _v_scrollbar, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _rectangles.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_rectangles.at(alias).specs().alias(alias);
 			return _rectangles.at(alias).specs();
@@ -163,6 +167,7 @@ namespace liblec {
 			if (_labels.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _labels.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_labels.at(alias).specs().alias(alias);
 			return _labels.at(alias).specs();
@@ -174,6 +179,7 @@ namespace liblec {
 			if (_groups.try_emplace(alias, _pg, alias).second) {
 				_widgets.emplace(alias, _groups.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_groups.at(alias).specs().alias(alias);
 			return _groups.at(alias).specs();
@@ -185,6 +191,7 @@ namespace liblec {
 			if (_buttons.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _buttons.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_buttons.at(alias).specs().alias(alias);
 			return _buttons.at(alias).specs();
@@ -196,6 +203,7 @@ namespace liblec {
 			if (_toggles.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _toggles.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_toggles.at(alias).specs().alias(alias);
 			return _toggles.at(alias).specs();
@@ -207,6 +215,8 @@ namespace liblec {
 			if (_table_views.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _table_views.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
+				_fm._d._special_pane_moves_pending = true;	// to be moved into a special pane
 			}
 			_table_views.at(alias).specs().alias(alias);
 			return _table_views.at(alias).specs();
@@ -218,6 +228,7 @@ namespace liblec {
 			if (_customs.try_emplace(alias, _pg, alias, _p_directwrite_factory, _p_iwic_factory).second) {
 				_widgets.emplace(alias, _customs.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_customs.at(alias).specs().alias(alias);
 			return _customs.at(alias).specs();
@@ -229,6 +240,7 @@ namespace liblec {
 			if (_image_views.try_emplace(alias, _pg, alias, _p_iwic_factory, _p_directwrite_factory, _p_direct2d_factory).second) {
 				_widgets.emplace(alias, _image_views.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_image_views.at(alias).specs().alias(alias);
 			return _image_views.at(alias).specs();
@@ -240,6 +252,7 @@ namespace liblec {
 			if (_progress_indicators.try_emplace(alias, _pg, alias, _p_direct2d_factory, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _progress_indicators.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_progress_indicators.at(alias).specs().alias(alias);
 			return _progress_indicators.at(alias).specs();
@@ -251,6 +264,7 @@ namespace liblec {
 			if (_progress_bars.try_emplace(alias, _pg, alias, _p_direct2d_factory, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _progress_bars.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_progress_bars.at(alias).specs().alias(alias);
 			return _progress_bars.at(alias).specs();
@@ -262,6 +276,7 @@ namespace liblec {
 			if (_checkboxes.try_emplace(alias, _pg, alias, _p_direct2d_factory, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _checkboxes.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_checkboxes.at(alias).specs().alias(alias);
 			return _checkboxes.at(alias).specs();
@@ -273,6 +288,7 @@ namespace liblec {
 			if (_text_fields.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _text_fields.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_text_fields.at(alias).specs().alias(alias);
 			return _text_fields.at(alias).specs();
@@ -284,6 +300,8 @@ namespace liblec {
 			if (_trees.try_emplace(alias, _pg, alias, _p_direct2d_factory, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _trees.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
+				_fm._d._special_pane_moves_pending = true;	// to be moved into a special pane
 			}
 			_trees.at(alias).specs().alias(alias);
 			return _trees.at(alias).specs();
@@ -295,6 +313,7 @@ namespace liblec {
 			if (_sliders.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _sliders.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_sliders.at(alias).specs().alias(alias);
 			return _sliders.at(alias).specs();
@@ -306,6 +325,8 @@ namespace liblec {
 			if (_html_editors.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _html_editors.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
+				_fm._d._special_pane_moves_pending = true;	// to be moved into a special pane
 			}
 			_html_editors.at(alias).specs().alias(alias);
 			return _html_editors.at(alias).specs();
@@ -317,6 +338,7 @@ namespace liblec {
 			if (_comboboxes.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _comboboxes.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_comboboxes.at(alias).specs().alias(alias);
 			return _comboboxes.at(alias).specs();
@@ -328,6 +350,7 @@ namespace liblec {
 			if (_lines.try_emplace(alias, _pg, alias).second) {
 				_widgets.emplace(alias, _lines.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_lines.at(alias).specs().alias(alias);
 			return _lines.at(alias).specs();
@@ -339,6 +362,8 @@ namespace liblec {
 			if (_times.try_emplace(alias, _pg, alias).second) {
 				_widgets.emplace(alias, _times.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
+				_fm._d._special_pane_moves_pending = true;	// to be moved into a special pane
 			}
 			_times.at(alias).specs().alias(alias);
 			return _times.at(alias).specs();
@@ -350,6 +375,8 @@ namespace liblec {
 			if (_dates.try_emplace(alias, _pg, alias).second) {
 				_widgets.emplace(alias, _dates.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
+				_fm._d._special_pane_moves_pending = true;	// to be moved into a special pane
 			}
 			_dates.at(alias).specs().alias(alias);
 			return _dates.at(alias).specs();
@@ -361,6 +388,8 @@ namespace liblec {
 			if (_icons.try_emplace(alias, _pg, alias, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _icons.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
+				_fm._d._special_pane_moves_pending = true;	// to be moved into a special pane
 			}
 			_icons.at(alias).specs().alias(alias);
 			return _icons.at(alias).specs();
@@ -372,6 +401,7 @@ namespace liblec {
 			if (_strength_bars.try_emplace(alias, _pg, alias, _p_direct2d_factory, _p_directwrite_factory).second) {
 				_widgets.emplace(alias, _strength_bars.at(alias));
 				_widgets_order.emplace_back(alias);
+				_widgets_generation++;
 			}
 			_strength_bars.at(alias).specs().alias(alias);
 			return _strength_bars.at(alias).specs();
@@ -383,11 +413,34 @@ namespace liblec {
 		const std::vector<std::string>&
 			containers::page::impl::widgets_order() { return _widgets_order; }
 
+		unsigned long long
+			containers::page::impl::widgets_generation() { return _widgets_generation; }
+
 		widgets::h_scrollbar_impl&
 			containers::page::impl::h_scrollbar() { return _h_scrollbar; }
 		widgets::v_scrollbar_impl&
 			containers::page::impl::v_scrollbar() { return _v_scrollbar; }
 
+		widget_grid&
+			containers::page::impl::grid() { return _grid; }
+
+		void containers::page::impl::place_in_grid(widgets::widget_impl& widget) {
+			const auto type = widget.type();
+
+			if (type == widgets::widget_type::tab_pane ||
+				type == widgets::widget_type::pane ||
+				type == widgets::widget_type::h_scrollbar ||
+				type == widgets::widget_type::v_scrollbar ||
+				(type == widgets::widget_type::rectangle &&
+					widget.alias() == widgets::rectangle_impl::page_rect_alias()))
+				// hit tested wherever the mouse is: the containers lead to their pages, the
+				// scroll bars are placed outside the page offsets and the page rectangle
+				// is hit tested without them
+				_grid.place_everywhere(&widget);
+			else
+				_grid.place(&widget, widget.get_rect());
+		}
+
 		widgets::tab_pane_impl&
 			containers::page::impl::get_tab_pane_impl(const std::string& alias) { return _tab_panes.at(alias); }
 
@@ -475,7 +528,13 @@ namespace liblec {
 				/// 3. removing it from _widgets_order
 
 				// step 1
+				auto it = _widgets.find(_alias);
+				if (it != _widgets.end())
+					_grid.remove(&it->second);
+
 				_widgets.erase(_alias);
+				_widgets_generation++;
+				_fm._d.clear_widget_index();
 
 				// step 2
 				switch (type) {
@@ -13,6 +13,7 @@
 #include <optional>
 
 #include "../page.h"
+#include "widget_grid.h"
 #include "../../widgets/h_scrollbar/h_scrollbar_impl.h"
 #include "../../widgets/v_scrollbar/v_scrollbar_impl.h"
 
@@ -126,10 +127,18 @@ namespace liblec {
 				widgets();
 			const std::vector<std::string>&
 				widgets_order();
+
+			/// <summary>Get a number that changes whenever a widget is added to or closed in the
+			/// page.</summary>
+			unsigned long long
+				widgets_generation();
 			widgets::h_scrollbar_impl&
 				h_scrollbar();
 			widgets::v_scrollbar_impl&
 				v_scrollbar();
+			widget_grid&
+				grid();
+			void place_in_grid(widgets::widget_impl& widget);
 
 			widgets::tab_pane_impl&
 				get_tab_pane_impl(const std::string& alias);
@@ -206,6 +215,8 @@ namespace liblec {
 
 			std::map<std::string, widgets::widget_impl&> _widgets;
 			std::vector<std::string> _widgets_order;
+			unsigned long long _widgets_generation;
+			widget_grid _grid;	// where the widgets were placed in the last render
 
 			widgets::h_scrollbar_impl _h_scrollbar;
 			widgets::v_scrollbar_impl _v_scrollbar;
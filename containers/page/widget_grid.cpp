@@ -0,0 +1,126 @@
+//
+// widget_grid.cpp - widget grid implementation
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#include "widget_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace liblec {
+	namespace lecui {
+		constexpr float grid_cell_size = 64.f;	// the width and height of a grid cell, in DIPs
+		constexpr long grid_max_cells = 256;		// widgets larger than this are placed everywhere instead
+
+		void widget_grid::place(widgets::widget_impl* p_widget, const D2D1_RECT_F& rect) {
+			// widen the rect a little so that points on its edges are never missed due to rounding
+			cell_range cells;
+			cells.left = static_cast<long>(std::floor((smallest(rect.left, rect.right) - 1.f) / grid_cell_size));
+			cells.top = static_cast<long>(std::floor((smallest(rect.top, rect.bottom) - 1.f) / grid_cell_size));
+			cells.right = static_cast<long>(std::floor((largest(rect.left, rect.right) + 1.f) / grid_cell_size));
+			cells.bottom = static_cast<long>(std::floor((largest(rect.top, rect.bottom) + 1.f) / grid_cell_size));
+
+			if ((cells.right - cells.left + 1) * (cells.bottom - cells.top + 1) > grid_max_cells) {
+				place_everywhere(p_widget);
+				return;
+			}
+
+			auto& e = _entries[p_widget];
+
+			if (e.everywhere) {
+				_everywhere.erase(std::remove(_everywhere.begin(), _everywhere.end(), p_widget), _everywhere.end());
+				e.everywhere = false;
+			}
+			else
+				if (e.cells == cells)
+					return;	// hasn't moved to other cells
+				else
+					remove_from_cells(p_widget, e.cells);
+
+			add_to_cells(p_widget, cells);
+			e.cells = cells;
+		}
+
+		void widget_grid::place_everywhere(widgets::widget_impl* p_widget) {
+			auto& e = _entries[p_widget];
+
+			if (e.everywhere)
+				return;
+
+			remove_from_cells(p_widget, e.cells);
+			e.cells = cell_range();
+			e.everywhere = true;
+			_everywhere.push_back(p_widget);
+		}
+
+		void widget_grid::remove(widgets::widget_impl* p_widget) {
+			_hot.erase(std::remove(_hot.begin(), _hot.end(), p_widget), _hot.end());
+
+			auto it = _entries.find(p_widget);
+
+			if (it == _entries.end())
+				return;
+
+			if (it->second.everywhere)
+				_everywhere.erase(std::remove(_everywhere.begin(), _everywhere.end(), p_widget), _everywhere.end());
+			else
+				remove_from_cells(p_widget, it->second.cells);
+
+			_entries.erase(it);
+		}
+
+		void widget_grid::candidates(const D2D1_POINT_2F& point,
+			std::vector<widgets::widget_impl*>& candidates) const {
+			candidates = _everywhere;
+			candidates.insert(candidates.end(), _hot.begin(), _hot.end());
+
+			auto it = _cells.find(cell_key(
+				static_cast<long>(std::floor(point.x / grid_cell_size)),
+				static_cast<long>(std::floor(point.y / grid_cell_size))));
+
+			if (it != _cells.end())
+				candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+		}
+
+		const std::vector<widgets::widget_impl*>& widget_grid::everywhere() const {
+			return _everywhere;
+		}
+
+		void widget_grid::hot(const std::vector<widgets::widget_impl*>& hot) {
+			_hot = hot;
+		}
+
+		void widget_grid::add_to_cells(widgets::widget_impl* p_widget, const cell_range& cells) {
+			for (long y = cells.top; y <= cells.bottom; y++)
+				for (long x = cells.left; x <= cells.right; x++)
+					_cells[cell_key(x, y)].push_back(p_widget);
+		}
+
+		void widget_grid::remove_from_cells(widgets::widget_impl* p_widget, const cell_range& cells) {
+			for (long y = cells.top; y <= cells.bottom; y++)
+				for (long x = cells.left; x <= cells.right; x++) {
+					auto it = _cells.find(cell_key(x, y));
+
+					if (it == _cells.end())
+						continue;
+
+					auto& cell = it->second;
+					cell.erase(std::remove(cell.begin(), cell.end(), p_widget), cell.end());
+
+					if (cell.empty())
+						_cells.erase(it);
+				}
+		}
+
+		long long widget_grid::cell_key(const long& x, const long& y) {
+			return (static_cast<long long>(y) << 32) | static_cast<std::uint32_t>(x);
+		}
+	}
+}
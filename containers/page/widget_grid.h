@@ -0,0 +1,86 @@
+//
+// widget_grid.h - widget grid interface
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#pragma once
+
+#include "../../form_common.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace liblec {
+	namespace lecui {
+		namespace widgets {
+			class widget_impl;
+		}
+
+		/// <summary>A uniform grid over the rects of a page's widgets, for finding the widgets
+		/// under the mouse without visiting every widget in the page.</summary>
+		/// <remarks>Each widget is listed in every cell its rect overlaps. When a widget is placed
+		/// again only the cells it has moved into or out of are touched, so keeping the grid up
+		/// to date during a render costs little unless the widgets are being scrolled. Widgets
+		/// that are too large for the grid to help with are listed as being everywhere.</remarks>
+		class widget_grid {
+		public:
+			widget_grid() {}
+
+			/// <summary>Record where a widget is.</summary>
+			/// <param name="p_widget">The widget.</param>
+			/// <param name="rect">The widget's rect, in DIPs.</param>
+			void place(widgets::widget_impl* p_widget, const D2D1_RECT_F& rect);
+
+			/// <summary>Make a widget a candidate wherever the point is.</summary>
+			/// <param name="p_widget">The widget.</param>
+			void place_everywhere(widgets::widget_impl* p_widget);
+
+			/// <summary>Remove a widget from the grid.</summary>
+			/// <param name="p_widget">The widget.</param>
+			void remove(widgets::widget_impl* p_widget);
+
+			/// <summary>Get the widgets whose rects may contain a point.</summary>
+			/// <param name="point">The point, in DIPs.</param>
+			/// <param name="candidates">The widgets, in no particular order and possibly repeated.
+			/// Those placed everywhere and the hot ones are always included.</param>
+			void candidates(const D2D1_POINT_2F& point, std::vector<widgets::widget_impl*>& candidates) const;
+
+			/// <summary>Get the widgets that are placed everywhere.</summary>
+			const std::vector<widgets::widget_impl*>& everywhere() const;
+
+			/// <summary>Record the widgets that are currently hit, so that they remain candidates
+			/// until the mouse has left them.</summary>
+			/// <param name="hot">The widgets.</param>
+			void hot(const std::vector<widgets::widget_impl*>& hot);
+
+		private:
+			struct cell_range {
+				long left = 0, top = 0, right = -1, bottom = -1;	// inclusive; empty by default
+
+				bool operator==(const cell_range& param) const {
+					return left == param.left && top == param.top &&
+						right == param.right && bottom == param.bottom;
+				}
+			};
+
+			struct entry {
+				cell_range cells;
+				bool everywhere = false;
+			};
+
+			void add_to_cells(widgets::widget_impl* p_widget, const cell_range& cells);
+			void remove_from_cells(widgets::widget_impl* p_widget, const cell_range& cells);
+			static long long cell_key(const long& x, const long& y);
+
+			std::unordered_map<widgets::widget_impl*, entry> _entries;
+			std::unordered_map<long long, std::vector<widgets::widget_impl*>> _cells;
+			std::vector<widgets::widget_impl*> _everywhere;
+			std::vector<widgets::widget_impl*> _hot;
+		};
+	}
+}
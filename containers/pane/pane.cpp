@@ -83,30 +83,14 @@ namespace liblec {
 		}
 
 		containers::pane& containers::pane_builder::get(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-
-					auto& impl = results.page._d_page.get_pane_impl(results.widget.alias());
-					return impl._p_panes.at(impl._current_pane);
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-
-					auto& impl = results.page._d_page.get_pane_impl(results.widget.alias());
-					return impl._p_panes.at(impl._current_pane);
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+
+				auto& impl = results.page._d_page.get_pane_impl(results.widget.alias());
+				return impl._p_panes.at(impl._current_pane);
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -159,59 +143,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& containers::pane_specs::cursor() { return _cursor; }
+		widgets::widget::cursor_type& containers::pane_specs::cursor() { _generation++; return _cursor; }
 
 		containers::pane_specs& containers::pane_specs::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& containers::pane_specs::font() { return _font; }
+		std::string& containers::pane_specs::font() { _generation++; return _font; }
 
 		containers::pane_specs& containers::pane_specs::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& containers::pane_specs::font_size() { return _font_size; }
+		float& containers::pane_specs::font_size() { _generation++; return _font_size; }
 
 		containers::pane_specs& containers::pane_specs::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::pane_specs::color_text() { return _color_text; }
+		color& containers::pane_specs::color_text() { _generation++; return _color_text; }
 
 		containers::pane_specs& containers::pane_specs::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::pane_specs::color_fill() { return _color_fill; }
+		color& containers::pane_specs::color_fill() { _generation++; return _color_fill; }
 
 		containers::pane_specs& containers::pane_specs::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::pane_specs::color_hot() { return _color_hot; }
+		color& containers::pane_specs::color_hot() { _generation++; return _color_hot; }
 
 		containers::pane_specs& containers::pane_specs::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::pane_specs::color_selected() { return _color_selected; }
+		color& containers::pane_specs::color_selected() { _generation++; return _color_selected; }
 
 		containers::pane_specs& containers::pane_specs::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::pane_specs::color_disabled() { return _color_disabled; }
+		color& containers::pane_specs::color_disabled() { _generation++; return _color_disabled; }
 
 		containers::pane_specs& containers::pane_specs::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -222,10 +214,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& containers::pane_specs::color_border() { return _color_border; }
+		lecui::color& containers::pane_specs::color_border() { _generation++; return _color_border; }
 
 		containers::pane_specs& containers::pane_specs::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -215,7 +215,6 @@ namespace liblec {
 				_size_initialized = true;
 			}
 
-			_specs_old = _specs;
 			_is_static = false;
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -256,12 +255,14 @@ namespace liblec {
 			widgets::pane_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
 			auto& _specs = _p_panes.at(_current_pane);
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_initial_capture_done) {
 				_rect_original = _specs.rect();
 				_rect_previous = _specs.rect();
@@ -354,6 +355,8 @@ namespace liblec {
 			return { width_change, height_change };
 		}
 
+		bool widgets::pane_impl::bounds_from_specs() { return false; }
+
 		bool widgets::pane_impl::contains() {
 			return widget_impl::contains();
 		}
@@ -92,7 +92,6 @@ namespace liblec {
 				pane_impl& operator=(const pane_impl&) = delete;
 
 				/// Private variables
-				containers::pane_specs _specs_old;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_border;
@@ -110,6 +109,9 @@ namespace liblec {
 				/// Important override for pane to work properly.
 				bool contains() override;
 
+				/// The pane's render keeps its page in step with its rect, so it can't be skipped.
+				bool bounds_from_specs() override;
+
 				IDWriteFactory* _p_directwrite_factory;
 
 				badge_resources _badge_resources;
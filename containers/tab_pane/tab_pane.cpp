@@ -97,26 +97,12 @@ namespace liblec {
 		containers::tab_pane&
 			containers::tab_pane_builder::get(form& fm,
 				const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_tab_pane_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_tab_pane_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_tab_pane_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -473,59 +459,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& containers::tab_pane::cursor() { return _cursor; }
+		widgets::widget::cursor_type& containers::tab_pane::cursor() { _generation++; return _cursor; }
 
 		containers::tab_pane& containers::tab_pane::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& containers::tab_pane::font() { return _font; }
+		std::string& containers::tab_pane::font() { _generation++; return _font; }
 
 		containers::tab_pane& containers::tab_pane::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& containers::tab_pane::font_size() { return _font_size; }
+		float& containers::tab_pane::font_size() { _generation++; return _font_size; }
 
 		containers::tab_pane& containers::tab_pane::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::tab_pane::color_text() { return _color_text; }
+		color& containers::tab_pane::color_text() { _generation++; return _color_text; }
 
 		containers::tab_pane& containers::tab_pane::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::tab_pane::color_fill() { return _color_fill; }
+		color& containers::tab_pane::color_fill() { _generation++; return _color_fill; }
 
 		containers::tab_pane& containers::tab_pane::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::tab_pane::color_hot() { return _color_hot; }
+		color& containers::tab_pane::color_hot() { _generation++; return _color_hot; }
 
 		containers::tab_pane& containers::tab_pane::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::tab_pane::color_selected() { return _color_selected; }
+		color& containers::tab_pane::color_selected() { _generation++; return _color_selected; }
 
 		containers::tab_pane& containers::tab_pane::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& containers::tab_pane::color_disabled() { return _color_disabled; }
+		color& containers::tab_pane::color_disabled() { _generation++; return _color_disabled; }
 
 		containers::tab_pane& containers::tab_pane::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -536,10 +530,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& containers::tab_pane::color_border() { return _color_border; }
+		lecui::color& containers::tab_pane::color_border() { _generation++; return _color_border; }
 
 		containers::tab_pane& containers::tab_pane::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -578,17 +573,19 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& containers::tab_pane::color_tabs() { return _color_tabs; }
+		lecui::color& containers::tab_pane::color_tabs() { _generation++; return _color_tabs; }
 
 		containers::tab_pane& containers::tab_pane::color_tabs(const color& color_tabs) {
 			_color_tabs = color_tabs;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& containers::tab_pane::color_tabs_border() { return _color_tabs_border; }
+		lecui::color& containers::tab_pane::color_tabs_border() { _generation++; return _color_tabs_border; }
 
 		containers::tab_pane& containers::tab_pane::color_tabs_border(const color& color_tabs_border) {
 			_color_tabs_border = color_tabs_border;
+			_generation++;
 			return *this;
 		}
 
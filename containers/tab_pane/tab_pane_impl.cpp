@@ -51,7 +51,6 @@ namespace liblec {
 
 		HRESULT widgets::tab_pane_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = false;
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -152,12 +151,11 @@ namespace liblec {
 				catch (const std::exception&) {}
 			}
 
-			if (_specs_old != _specs || tab_badge_change || _tabs_changed) {
+			if (specs_changed() || tab_badge_change || _tabs_changed) {
 				// reset tabs change flag
 				_tabs_changed = false;
 
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 
 				_badge_specs_old.clear();
 				for (auto& [tab_name, tab] : _p_tabs)
@@ -166,6 +164,9 @@ namespace liblec {
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_initial_capture_done) {
 				_rect_original = _specs.rect();
 				_rect_previous = _specs.rect();
@@ -765,6 +766,8 @@ namespace liblec {
 			return { width_change, height_change };
 		}
 
+		bool widgets::tab_pane_impl::bounds_from_specs() { return false; }
+
 		bool widgets::tab_pane_impl::contains() {
 			for (const auto& it : _p_tab_rects) {
 				D2D1_RECT_F rect = it.second;
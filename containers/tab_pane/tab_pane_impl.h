@@ -80,7 +80,7 @@ namespace liblec {
 				tab_pane_impl& operator=(const tab_pane_impl&) = delete;
 
 				/// Private variables
-				containers::tab_pane _specs, _specs_old;
+				containers::tab_pane _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_border;
@@ -111,6 +111,9 @@ namespace liblec {
 
 				/// Important override for tab pane to work properly.
 				bool contains();
+
+				/// The tab pane's render keeps its pages in step with its rect, so it can't be skipped.
+				bool bounds_from_specs() override;
 			};
 		}
 	}
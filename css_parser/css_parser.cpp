@@ -9,61 +9,239 @@
 //
 
 #include "css_parser.h"
+#include <charconv>
 
-std::vector<std::string> split_line(const std::string& line,
-	std::string seperator) {
-	std::vector<std::string> data;
+bool css_is_space(const char c) {
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+std::string_view css_trim(std::string_view text) {
+	while (!text.empty() && css_is_space(text.front()))
+		text.remove_prefix(1);
+
+	while (!text.empty() && css_is_space(text.back()))
+		text.remove_suffix(1);
+
+	return text;
+}
+
+bool css_starts_with(std::string_view text, std::string_view prefix) {
+	if (text.length() < prefix.length())
+		return false;
+
+	// case insensitive
+	for (size_t i = 0; i < prefix.length(); i++) {
+		const auto c = text[i] >= 'A' && text[i] <= 'Z' ? text[i] - 'A' + 'a' : text[i];
+
+		if (c != prefix[i])
+			return false;
+	}
+
+	return true;
+}
+
+bool css_ends_with(std::string_view text, std::string_view suffix) {
+	return text.length() >= suffix.length() &&
+		css_starts_with(text.substr(text.length() - suffix.length()), suffix);
+}
+
+int css_hex_digit(const char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+bool css_parser::next(std::string_view& style_string, css_declaration& declaration) {
+	while (!style_string.empty()) {
+		const auto semicolon = style_string.find(';');
+		const auto segment = style_string.substr(0, semicolon);
+		style_string.remove_prefix(semicolon == std::string_view::npos ?
+			style_string.length() : semicolon + 1);
 
-	auto add = [&](std::string s) {
-		// trim leading whitespace
-		s.erase(0, s.find_first_not_of(" "));
+		// a declaration has exactly two parts, the property and the value
+		const auto colon = segment.find(':');
 
-		// trim trailing whitespace
-		s.erase(s.find_last_not_of(" ") + 1);
+		if (colon == std::string_view::npos ||
+			segment.find(':', colon + 1) != std::string_view::npos)
+			continue;
 
-		if (!s.empty())
-			data.push_back(s);
+		const auto property = css_trim(segment.substr(0, colon));
+		const auto value = css_trim(segment.substr(colon + 1));
+
+		if (property.empty() || value.empty())
+			continue;
+
+		declaration.key = key(property);
+		declaration.property = property;
+		declaration.value = value;
+		return true;
+	}
+
+	return false;
+}
+
+css_parser::property_key css_parser::key(std::string_view property) {
+	if (property.empty())
+		return property_key::unknown;
+
+	// perfect hash of the supported property names: (3 * length + first + last) % 8
+	struct entry {
+		std::string_view name;
+		property_key key;
+	};
+
+	static constexpr entry table[8] = {
+		{ "font-family", property_key::font_family },
+		{ "font-style", property_key::font_style },
+		{ "", property_key::unknown },
+		{ "font-weight", property_key::font_weight },
+		{ "color", property_key::color },
+		{ "", property_key::unknown },
+		{ "font-size", property_key::font_size },
+		{ "text-decoration", property_key::text_decoration },
 	};
 
-	try {
-		data.clear();
+	const auto& it = table[(3 * property.length() +
+		static_cast<unsigned char>(property.front()) +
+		static_cast<unsigned char>(property.back())) % 8];
+
+	return it.name == property ? it.key : property_key::unknown;
+}
+
+bool css_parser::parse_number(std::string_view value, float& number) {
+	value = css_trim(value);
 
-		std::string _line(line);
+	if (value.empty())
+		return false;
+
+	float result = 0.f;
+	const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.length(), result);
+
+	if (ec != std::errc() || ptr != value.data() + value.length())
+		return false;
+
+	number = result;
+	return true;
+}
 
-		while (true) {
-			auto idx = _line.find(seperator);
+bool css_parser::parse_font_size(std::string_view value, float& points) {
+	value = css_trim(value);
 
-			if (idx == std::string::npos) {
-				add(_line);
-				break;
-			}
+	if (css_ends_with(value, "pt"))
+		return parse_number(value.substr(0, value.length() - 2), points);
 
-			auto s = _line.substr(0, idx);
-			_line.erase(0, idx + 1);
-			add(s);
+	if (css_ends_with(value, "px")) {
+		float pixels = 0.f;
+
+		if (!parse_number(value.substr(0, value.length() - 2), pixels))
+			return false;
+
+		points = pixels * 72.f / 96.f;
+		return true;
+	}
+
+	// to-do: handle sizes that are described in neither points nor pixels
+	return false;
+}
+
+bool css_parser::parse_color(std::string_view value, css_color& color) {
+	value = css_trim(value);
+
+	if (css_starts_with(value, "rgb")) {
+		// color is described in rgb, e.g. rgb(12, 45, 125) or rgba(12, 45, 125, 0.5)
+		const auto open = value.find('(');
+		const auto close = value.find(')', open);
+
+		if (open == std::string_view::npos || close == std::string_view::npos)
+			return false;
+
+		auto arguments = value.substr(open + 1, close - (open + 1));
+		float components[4] = { 0.f, 0.f, 0.f, 1.f };
+		size_t count = 0;
+
+		while (!arguments.empty()) {
+			const auto comma = arguments.find(',');
+			const auto argument = css_trim(arguments.substr(0, comma));
+			arguments.remove_prefix(comma == std::string_view::npos ?
+				arguments.length() : comma + 1);
+
+			if (argument.empty())
+				continue;
+
+			if (count == 4 || !parse_number(argument, components[count]))
+				return false;
+
+			count++;
 		}
+
+		if (count < 3)
+			return false;
+
+		color.r = components[0] / 255.f;
+		color.g = components[1] / 255.f;
+		color.b = components[2] / 255.f;
+		color.a = components[3];
+		return true;
 	}
-	catch (const std::exception&) {}
 
-	return data;
+	// color is described in hexadecimal, e.g. #0c2d7d, #0c2d7dff or 0x0c2d7dff
+	std::string_view digits;
+
+	if (!value.empty() && value.front() == '#')
+		digits = value.substr(1);
+	else
+		if (css_starts_with(value, "0x"))
+			digits = value.substr(2);
+		else {
+			// to-do: handle color that is described using a word, e.g. "red"
+			return false;
+		}
+
+	if (digits.empty() || digits.length() > 8)
+		return false;
+
+	int nibbles[8] = { 0 };
+
+	for (size_t i = 0; i < digits.length(); i++) {
+		nibbles[i] = css_hex_digit(digits[i]);
+
+		if (nibbles[i] < 0)
+			return false;
+	}
+
+	unsigned long hex = 0;
+
+	if (digits.length() == 3 || digits.length() == 4) {
+		// shorthand, e.g. #fc0 for #ffcc00
+		for (size_t i = 0; i < 4; i++) {
+			const auto nibble = i < digits.length() ? nibbles[i] : 0xf;
+			hex = (hex << 8) | (nibble << 4) | nibble;
+		}
+	}
+	else {
+		// missing digits, e.g. the alpha, are taken to be f
+		for (size_t i = 0; i < 8; i++)
+			hex = (hex << 4) | (i < digits.length() ? nibbles[i] : 0xf);
+	}
+
+	color.r = static_cast<float>((hex >> 24) & 0xff) / 255.f;
+	color.g = static_cast<float>((hex >> 16) & 0xff) / 255.f;
+	color.b = static_cast<float>((hex >> 8) & 0xff) / 255.f;
+	color.a = static_cast<float>((hex >> 0) & 0xff) / 255.f;
+	return true;
 }
 
 std::vector<css_parser::css_property>
 css_parser::read(const std::string style_string) {
 	std::vector<css_property> css_properties;
 
-	// get the segments
-	const auto segments = split_line(style_string, ";");
+	std::string_view remaining(style_string);
+	css_declaration declaration;
 
-	for (const auto& segment : segments) {
-		// get the segment parts
-		const auto parts = split_line(segment, ":");
-
-		if (parts.size() == 2) {
-			// get the property
-			css_properties.push_back(css_property{ parts[0], parts[1] });
-		}
-	}
+	while (next(remaining, declaration))
+		css_properties.push_back(css_property{ std::string(declaration.property),
+			std::string(declaration.value) });
 
 	return css_properties;
 }
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 /// <summary>A custom CSS parser that describes CSS styles in a data structure.</summary>
@@ -31,6 +32,73 @@ public:
 	/// <returns>The CSS properties.</returns>
 	std::vector<css_property> read(const std::string style_string);
 
+	/// <summary>The CSS properties that are understood by the library.</summary>
+	enum class property_key {
+		unknown,
+		color,
+		font_family,
+		font_size,
+		font_style,
+		font_weight,
+		text_decoration,
+	};
+
+	/// <summary>A CSS declaration, e.g. color: rgb(12, 45, 125).</summary>
+	/// <remarks>The property and value are views into the style string that was parsed.</remarks>
+	struct css_declaration {
+		/// <summary>The property, as defined in <see cref="property_key"></see>.</summary>
+		property_key key = property_key::unknown;
+
+		/// <summary>The name of the property, e.g. color.</summary>
+		std::string_view property;
+
+		/// <summary>The value of the property, e.g. rgb(12, 45, 125).</summary>
+		std::string_view value;
+	};
+
+	/// <summary>A color with components in the range 0 to 1.</summary>
+	struct css_color {
+		float r = 0.f;
+		float g = 0.f;
+		float b = 0.f;
+		float a = 1.f;
+	};
+
+	/// <summary>Read the next CSS declaration from a CSS style string without making any
+	/// copies.</summary>
+	/// <param name="style_string">The CSS style string. The declaration that is read is removed
+	/// from the front of the view.</param>
+	/// <param name="declaration">The declaration.</param>
+	/// <returns>Returns true if a declaration was read, else false if there are none left.
+	/// </returns>
+	/// <remarks>Malformed declarations, e.g. those without a value, are skipped.</remarks>
+	static bool next(std::string_view& style_string, css_declaration& declaration);
+
+	/// <summary>Look up the key of a CSS property.</summary>
+	/// <param name="property">The name of the property, e.g. font-size.</param>
+	/// <returns>The key, or property_key::unknown if the property is not understood.</returns>
+	static property_key key(std::string_view property);
+
+	/// <summary>Parse a CSS color value.</summary>
+	/// <param name="value">The value, e.g. rgb(12, 45, 125), #0c2d7d or #0c2d7dff.</param>
+	/// <param name="color">The color. It is only written to if the value is parsed
+	/// successfully.</param>
+	/// <returns>Returns true if successful, else false.</returns>
+	static bool parse_color(std::string_view value, css_color& color);
+
+	/// <summary>Parse a CSS font size value.</summary>
+	/// <param name="value">The value, e.g. 9pt or 12px.</param>
+	/// <param name="points">The font size in points. Pixels are converted at 96 pixels to the
+	/// inch.</param>
+	/// <returns>Returns true if successful, else false.</returns>
+	static bool parse_font_size(std::string_view value, float& points);
+
+	/// <summary>Parse a number.</summary>
+	/// <param name="value">The value, e.g. 9.5. Surrounding spaces are allowed.</param>
+	/// <param name="number">The number.</param>
+	/// <returns>Returns true if the entire value is a number, else false.</returns>
+	static bool parse_number(std::string_view value, float& number);
+
 	/// <summary>Write CSS properties to a CSS style string.</summary>
 	/// <param name="css_properties">The CSS properties.</param>
 	/// <returns>The CSS style string.</returns>
@@ -14,6 +14,7 @@
 #include "utilities/timer.h"
 #include "form_impl/form_impl.h"
 #include "error/win_error.h"
+#include "formatted_text_parser/formatted_text_parser.h"
 
 // Windows headers
 #include <Windows.h>
@@ -518,6 +519,19 @@ namespace liblec {
 			return _d.get_dpi_scale();
 		}
 
+		form::cache_statistics form::get_cache_statistics() {
+			const auto text = formatted_text_parser::statistics();
+
+			cache_statistics statistics;
+			statistics.formatted_text_hits = text.hits;
+			statistics.formatted_text_misses = text.misses;
+			statistics.formatted_text_entries = text.entries;
+			statistics.image_hits = _d._image_cache.hits();
+			statistics.image_misses = _d._image_cache.misses();
+			statistics.image_bytes = _d._image_cache.bytes();
+			return statistics;
+		}
+
 		void form::allow_minimize() {
 			if (!_d._allow_minimize)
 				return;
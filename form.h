@@ -78,6 +78,7 @@ namespace liblec {
 			class icon_impl;
 			class pane_impl;
 			class tab_pane_impl;
+			class group_impl;
 		}
 #endif
 
@@ -303,6 +304,37 @@ namespace liblec {
 			[[nodiscard]]
 			float get_dpi_scale();
 
+			/// <summary>Statistics of the caches that the form's widgets are drawn from.</summary>
+			/// <remarks>Useful for checking how effective the caches are on large forms.</remarks>
+			struct cache_statistics {
+				/// <summary>The number of formatted text reads that were served from the cache.
+				/// </summary>
+				/// <remarks>The formatted text cache is shared by all the forms in the app.</remarks>
+				unsigned long long formatted_text_hits = 0;
+
+				/// <summary>The number of formatted text reads that had to parse the text.</summary>
+				unsigned long long formatted_text_misses = 0;
+
+				/// <summary>The number of entries in the formatted text cache.</summary>
+				size_t formatted_text_entries = 0;
+
+				/// <summary>The number of image bitmaps that were served from the form's image
+				/// cache.</summary>
+				unsigned long long image_hits = 0;
+
+				/// <summary>The number of image bitmaps that had to be decoded or scaled.</summary>
+				unsigned long long image_misses = 0;
+
+				/// <summary>The memory taken up by the form's image cache, in bytes.</summary>
+				size_t image_bytes = 0;
+			};
+
+			/// <summary>Get the statistics of the caches that the form's widgets are drawn from.
+			/// </summary>
+			/// <returns>The statistics.</returns>
+			[[nodiscard]]
+			cache_statistics get_cache_statistics();
+
 			/// <summary>Minimize the form.</summary>
 			/// <remarks>This method does nothing if the form is already minimized or if it doesn't have the minimize button.</remarks>
 			void allow_minimize();
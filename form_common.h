@@ -17,8 +17,10 @@
 #include <dwrite.h>
 #include <wincodec.h>
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 namespace liblec {
 	namespace lecui {
@@ -256,6 +258,18 @@ namespace liblec {
 			return _rect;
 		}
 
+		/// <summary>Check whether two rectangles overlap.</summary>
+		/// <param name="rect_a">The first rectangle.</param>
+		/// <param name="rect_b">The second rectangle.</param>
+		/// <param name="margin">The distance by which the first rectangle is to be grown on
+		/// every side before the check is made.</param>
+		/// <returns>True if the rectangles overlap, else false.</returns>
+		static inline bool overlap(const D2D1_RECT_F& rect_a, const D2D1_RECT_F& rect_b,
+			const float& margin = 0.f) {
+			return rect_a.left - margin < rect_b.right && rect_b.left < rect_a.right + margin &&
+				rect_a.top - margin < rect_b.bottom && rect_b.top < rect_a.bottom + margin;
+		}
+
 		static inline rect convert_rect(const D2D1_RECT_F& rect) {
 			lecui::rect _rect;
 			_rect.left(rect.left);
@@ -332,6 +346,59 @@ namespace liblec {
 			return (((a) > (b)) ? (a) : (b));
 		}
 
+		/// <summary>Get the area to redraw in a partial render.</summary>
+		/// <param name="dirty_rects">The areas that have changed, in DIPs. Must not be empty.
+		/// </param>
+		/// <param name="p_update_rect">The area invalidated by the system, in pixels, e.g. when an
+		/// overlapping window is moved, or nullptr if there is none.</param>
+		/// <param name="dpi_scale">The DPI scale of the form.</param>
+		/// <returns>The bounding box of the areas, snapped to whole pixels so that a clip to it
+		/// doesn't leave partially cleared pixels on its edges.</returns>
+		static inline D2D1_RECT_F dirty_area(const std::vector<D2D1_RECT_F>& dirty_rects,
+			const RECT* p_update_rect, const float& dpi_scale) {
+			D2D1_RECT_F area = dirty_rects.front();
+
+			for (const auto& rect : dirty_rects) {
+				area.left = smallest(area.left, rect.left);
+				area.top = smallest(area.top, rect.top);
+				area.right = largest(area.right, rect.right);
+				area.bottom = largest(area.bottom, rect.bottom);
+			}
+
+			if (p_update_rect) {
+				area.left = smallest(area.left, static_cast<float>(p_update_rect->left) / dpi_scale);
+				area.top = smallest(area.top, static_cast<float>(p_update_rect->top) / dpi_scale);
+				area.right = largest(area.right, static_cast<float>(p_update_rect->right) / dpi_scale);
+				area.bottom = largest(area.bottom, static_cast<float>(p_update_rect->bottom) / dpi_scale);
+			}
+
+			area.left = std::floor(area.left * dpi_scale - 1.f) / dpi_scale;
+			area.top = std::floor(area.top * dpi_scale - 1.f) / dpi_scale;
+			area.right = std::ceil(area.right * dpi_scale + 1.f) / dpi_scale;
+			area.bottom = std::ceil(area.bottom * dpi_scale + 1.f) / dpi_scale;
+			return area;
+		}
+
+		/// <summary>Check whether a widget is to be drawn in a frame.</summary>
+		/// <param name="rect">The widget's rect.</param>
+		/// <param name="p_visible_area">The part of the widget's container that can be seen, or
+		/// nullptr if the widget is always in view.</param>
+		/// <param name="p_dirty_area">The area to redraw, or nullptr in a full render.</param>
+		/// <param name="culled">Set to true if the widget is out of view, else false.</param>
+		/// <returns>True if the widget is to be drawn, else false.</returns>
+		static inline bool widget_needs_render(const D2D1_RECT_F& rect,
+			const D2D1_RECT_F* p_visible_area, const D2D1_RECT_F* p_dirty_area, bool& culled) {
+			// allow for borders and anti-aliasing that spill over the widget's rect
+			const float margin = 2.f;
+
+			culled = p_visible_area && !overlap(rect, *p_visible_area, margin);
+
+			if (culled)
+				return false;
+
+			return !p_dirty_area || overlap(rect, *p_dirty_area, margin);
+		}
+
 		template <class t>
 		static inline void swap(t& left, t& right) {
 			t temp = left;
@@ -52,6 +52,8 @@
 // C++ STL headers
 #include <optional>
 
+#define MOVECOUNT	0	// set to 1 to log every pass made looking for widgets to move into special panes, 0 otherwise
+
 namespace liblec {
 	namespace lecui {
 		// initialize static variables
@@ -80,6 +82,8 @@ namespace liblec {
 			_caption_icon_minimum_margin(7.f),
 			_caption_icon_maximum_size(24.f),
 			_receive_data_timer_alias("liblec::lecui::receive_data_timer"),
+			_hittest_timer_alias("liblec::lecui::hittest_timer"),
+			_image_timer_alias("liblec::lecui::image_timer"),
 			_current_thread_id(GetCurrentThreadId()),
 			_resource_dll_filename(std::string()),
 			_resource_module_handle(nullptr),
@@ -124,6 +128,10 @@ namespace liblec {
 			_p_minimize_button(nullptr),
 			_point_before({ 0.f, 0.f }),
 			_user_sizing(false),
+			_hittest_pending(false),
+			_hittest_point({ 0.f, 0.f }),
+			_special_pane_moves_pending(true),
+			_images_pending(false),
 			_unique_id(1000),
 			_reverse_tab_navigation(false),
 			_shift_pressed(false),
@@ -132,13 +140,15 @@ namespace liblec {
 			_lbutton_pressed(false),
 			_h_widget_cursor(nullptr),
 			_schedule_refresh(false),
+			_full_repaint(true),
 			_close_called(false),
 			_force_instance(false),
 			_tray_icon_present(false),
 			_start_hidden(false),
 			_side_pane_present(false),
 			_side_pane_thickness(0.f),
-			_png_caption_icon(0) {
+			_png_caption_icon(0),
+			_widget_index_generation(0) {
 			++_instances;	// increment instances count
 
 			/// Use HeapSetInformation to specify that the process should terminate if the heap manager
@@ -148,7 +158,7 @@ namespace liblec {
 
 			// parse the caption
 			// the default color doesn't matter here we're just getting the plain text
-			std::vector<formatted_text_parser::text_range_properties> formatting;
+			std::shared_ptr<const formatted_text_parser::formatted_text_properties> formatting;
 			widgets::parse_formatted_text(_caption_formatted, _caption_plain,
 				D2D1::ColorF(D2D1::ColorF::Black), formatting);
 
@@ -202,6 +212,9 @@ namespace liblec {
 			//    resources in the client app when exiting; don't try doing it from here.
 			discard_device_resources(true);
 
+			// stop the image workers and release the decoded images while COM is still up
+			_image_cache.shutdown();
+
 			if (_initialized && _instances == 1) {
 				// release IWIC Imaging resources used by all instances
 				safe_release(&_p_iwic_factory);
@@ -248,8 +261,10 @@ namespace liblec {
 				D2D1_SIZE_U size = D2D1::SizeU(rc.right - rc.left, rc.bottom - rc.top);
 
 				// Create a Direct2D render target.
+				// retain the contents of the render target between frames so that a render can be
+				// confined to the areas of the form that have changed
 				hr = _p_direct2d_factory->CreateHwndRenderTarget(D2D1::RenderTargetProperties(),
-					D2D1::HwndRenderTargetProperties(_hWnd, size),
+					D2D1::HwndRenderTargetProperties(_hWnd, size, D2D1_PRESENT_OPTIONS_RETAIN_CONTENTS),
 					&_p_render_target);
 
 				if (SUCCEEDED(hr)) {
@@ -376,6 +391,9 @@ namespace liblec {
 			// discard form widget resources
 			for (const auto& widget : _widgets)
 				widget.second.discard_resources();
+
+			// discard the bitmaps made on the render target
+			_image_cache.discard_device_resources();
 		}
 
 		void form::impl::create_close_button(std::function<void()> on_click) {
@@ -624,12 +642,54 @@ namespace liblec {
 			}
 		}
 
-		void form::impl::update() { InvalidateRect(_hWnd, nullptr, FALSE); }
+		void form::impl::update() {
+			_full_repaint = true;
+			InvalidateRect(_hWnd, nullptr, FALSE);
+		}
+
+		void form::impl::update(const D2D1_RECT_F& rect) {
+			_dirty_rects.push_back(rect);
+
+			// invalidate the pixels covered by the rectangle
+			D2D1_RECT_F rect_scaled = rect;
+			scale_RECT(rect_scaled, _dpi_scale);
+
+			RECT rc = {
+				static_cast<LONG>(floor(rect_scaled.left)) - 1,
+				static_cast<LONG>(floor(rect_scaled.top)) - 1,
+				static_cast<LONG>(ceil(rect_scaled.right)) + 1,
+				static_cast<LONG>(ceil(rect_scaled.bottom)) + 1
+			};
+
+			InvalidateRect(_hWnd, &rc, FALSE);
+		}
+
+		void form::impl::watch_images() {
+			if (_images_pending || !_image_cache.pending())
+				return;
+
+			// poll for the images that are decoded in the background, as for table sorts
+			_images_pending = true;
+			timer_manager(_fm).add(_image_timer_alias, 15, [this]() { collect_images(); });
+		}
+
+		void form::impl::collect_images() {
+			const bool collected = _image_cache.collect();
+
+			if (!_image_cache.pending()) {
+				timer_manager(_fm).stop(_image_timer_alias);
+				_images_pending = false;
+			}
+
+			// the widgets that were waiting for the images draw them now
+			if (collected)
+				update();
+		}
 
 		/// The tree view widget is constructed as follows:
 		/// 1. A special pane is made for carrying the tree view
 		/// 2. The tree view widget is moved into the container
-		void form::impl::move_trees() {
+		bool form::impl::move_trees() {
 			// check if this page has a tree pane
 			auto page_iterator = _p_pages.find(_current_page);
 
@@ -644,6 +704,7 @@ namespace liblec {
 			};
 
 			std::vector<tree_info> trees;
+			bool moved = false;
 
 			if (page_iterator != _p_pages.end()) {
 				auto& page = page_iterator->second;
@@ -740,12 +801,18 @@ namespace liblec {
 
 						// close widget
 						std::string error;
-						it.source._d_page.close_widget(it.alias, widgets::widget_type::tree_view, error);
-						log("moving " + it.alias + " successful!");
+						if (it.source._d_page.close_widget(it.alias, widgets::widget_type::tree_view, error)) {
+							log("moving " + it.alias + " successful!");
+							moved = true;
+						}
+						else
+							log("moving " + it.alias + " failed: " + error);
 					}
 					catch (const std::exception& e) { log("moving " + it.alias + " failed: " + e.what()); }
 				}
 			}
+
+			return moved;
 		}
 
 		/// The html editor widget is constructed as follows:
@@ -753,7 +820,7 @@ namespace liblec {
 		/// 2. A special pane is made for carrying the html text
 		/// 3. The html widget is moved into the html container
 		/// 4. Control widgets are added to the control pane
-		void form::impl::move_html_editors() {
+		bool form::impl::move_html_editors() {
 			struct html_editor_info {
 				std::string alias;
 
@@ -869,6 +936,8 @@ namespace liblec {
 				std::vector<html_editor_info> html_editors;
 				move_helper::find_html_editors_to_move(page, html_editors);
 
+				bool moved = false;
+
 				// move the html editors
 				for (auto& it : html_editors) {
 					log("moving html_editor: " + it.alias + " from " + it.source._d_page.alias() + " to " + it.destination._d_page.alias());
@@ -906,8 +975,12 @@ namespace liblec {
 
 						// close the widget
 						std::string error;
-						it.source._d_page.close_widget(it.alias, widgets::widget_type::html_editor, error);
-						log("moving " + it.alias + " successful!");
+						if (it.source._d_page.close_widget(it.alias, widgets::widget_type::html_editor, error)) {
+							log("moving " + it.alias + " successful!");
+							moved = true;
+						}
+						else
+							log("moving " + it.alias + " failed: " + error);
 					}
 					catch (const std::exception& e) { log("moving " + it.alias + " failed: " + e.what()); }
 				}
@@ -1147,19 +1220,27 @@ namespace liblec {
 				};
 
 				controls_helper::add_html_controls(page);
+
+				return moved;
 			};
 
+			bool moved = false;
+
 			// check if this page has html widgets and move them if they exist
 			auto page_iterator = _p_pages.find(_current_page);
 
 			if (page_iterator != _p_pages.end()) {
 				auto& page = page_iterator->second;
-				do_move_html_editors(page);
+				if (do_move_html_editors(page))
+					moved = true;
 			}
 
 			// check if status panes have html editors and move them if they exist
 			for (auto& [alias, page] : _p_status_panes)
-				do_move_html_editors(page);
+				if (do_move_html_editors(page))
+					moved = true;
+
+			return moved;
 		}
 
 		/// The time widget is constructed as follows:
@@ -1171,7 +1252,7 @@ namespace liblec {
 		/// 4. A label with a colon is placed between each rectangle for use as seperators
 		/// 5. The rectangles are used for hit testing, and each has a handler that brings up a
 		/// context menu for editing the corresponding time component
-		void form::impl::move_times() {
+		bool form::impl::move_times() {
 			struct time_info {
 				std::string alias;
 
@@ -1248,6 +1329,8 @@ namespace liblec {
 				std::vector<time_info> times;
 				helper::find_times_to_move(page, times);
 
+				bool moved = false;
+
 				// move times
 				for (auto& it : times) {
 					log("moving time: " + it.alias + " from " + it.source._d_page.alias() + " to " + it.destination._d_page.alias());
@@ -1373,8 +1456,12 @@ namespace liblec {
 
 						// close widget
 						std::string error;
-						it.source._d_page.close_widget(it.alias, widgets::widget_type::time, error);
-						log("moving " + it.alias + " successful!");
+						if (it.source._d_page.close_widget(it.alias, widgets::widget_type::time, error)) {
+							log("moving " + it.alias + " successful!");
+							moved = true;
+						}
+						else
+							log("moving " + it.alias + " failed: " + error);
 					}
 					catch (const std::exception& e) { log("moving " + it.alias + " failed: " + e.what()); }
 				}
@@ -1513,19 +1600,27 @@ namespace liblec {
 				};
 
 				controls_helper::add_times(page);
+
+				return moved;
 			};
 
+			bool moved = false;
+
 			// check if this page has time widgets and move them if they exist
 			auto page_iterator = _p_pages.find(_current_page);
 
 			if (page_iterator != _p_pages.end()) {
 				auto& page = page_iterator->second;
-				do_move_times(page);
+				if (do_move_times(page))
+					moved = true;
 			}
 
 			// check if status panes have time widgets and move them if they exist
 			for (auto& [alias, page] : _p_status_panes)
-				do_move_times(page);
+				if (do_move_times(page))
+					moved = true;
+
+			return moved;
 		}
 
 		/// The date widget is constructed as follows:
@@ -1538,7 +1633,7 @@ namespace liblec {
 		/// 5. A label with a dash is placed between each rectangle for use as seperators
 		/// 6. The rectangles are used for hit testing, and each has a handler that brings up a
 		/// context menu for editing the corresponding date component
-		void form::impl::move_dates() {
+		bool form::impl::move_dates() {
 			struct date_info {
 				std::string alias;
 
@@ -1615,6 +1710,8 @@ namespace liblec {
 				std::vector<date_info> dates;
 				helper::find_dates_to_move(page, dates);
 
+				bool moved = false;
+
 				// move dates
 				for (auto& it : dates) {
 					log("moving date: " + it.alias + " from " + it.source._d_page.alias() + " to " + it.destination._d_page.alias());
@@ -1751,8 +1848,12 @@ namespace liblec {
 
 						// close widget
 						std::string error;
-						it.source._d_page.close_widget(it.alias, widgets::widget_type::date, error);
-						log("moving " + it.alias + " successful!");
+						if (it.source._d_page.close_widget(it.alias, widgets::widget_type::date, error)) {
+							log("moving " + it.alias + " successful!");
+							moved = true;
+						}
+						else
+							log("moving " + it.alias + " failed: " + error);
 					}
 					catch (const std::exception& e) { log("moving " + it.alias + " failed: " + e.what()); }
 				}
@@ -1920,19 +2021,27 @@ namespace liblec {
 				};
 
 				controls_helper::add_dates(page);
+
+				return moved;
 			};
 
+			bool moved = false;
+
 			// check if this page has a date widget
 			auto page_iterator = _p_pages.find(_current_page);
 
 			if (page_iterator != _p_pages.end()) {
 				auto& page = page_iterator->second;
-				do_move_dates(page);
+				if (do_move_dates(page))
+					moved = true;
 			}
 
 			// check if status panes have date widgets and move them if they exist
 			for (auto& [alias, page] : _p_status_panes)
-				do_move_dates(page);
+				if (do_move_dates(page))
+					moved = true;
+
+			return moved;
 		}
 
 		/// The icon widget is constructed as follows:
@@ -1941,7 +2050,7 @@ namespace liblec {
 		/// 3. An image view is added above the rectangle
 		/// 4. Two labels are added beside the image view, one is the icon text and the other is
 		/// the descriptive text
-		void form::impl::move_icons() {
+		bool form::impl::move_icons() {
 			struct icon_info {
 				std::string alias;
 
@@ -2019,6 +2128,8 @@ namespace liblec {
 				std::vector<icon_info> icons;
 				helper::find_icons_to_move(page, icons);
 
+				bool moved = false;
+
 				// move icons
 				for (auto& it : icons) {
 					log("moving icon: " + it.alias + " from " + it.source._d_page.alias() + " to " + it.destination._d_page.alias());
@@ -2240,30 +2351,42 @@ namespace liblec {
 
 						// close widget
 						std::string error;
-						it.source._d_page.close_widget(it.alias, widgets::widget_type::icon, error);
-						log("moving " + it.alias + " successful!");
+						if (it.source._d_page.close_widget(it.alias, widgets::widget_type::icon, error)) {
+							log("moving " + it.alias + " successful!");
+							moved = true;
+						}
+						else
+							log("moving " + it.alias + " failed: " + error);
 					}
 					catch (const std::exception& e) { log("moving " + it.alias + " failed: " + e.what()); }
 				}
+
+				return moved;
 			};
 
+			bool moved = false;
+
 			// check if this page has icon widgets and move them if they exist
 			auto page_iterator = _p_pages.find(_current_page);
 
 			if (_p_pages.count(_current_page)) {
 				auto& page = page_iterator->second;
-				do_move_icons(page);
+				if (do_move_icons(page))
+					moved = true;
 			}
 
 			// check if status panes have icon widgets and move them if they exist
 			for (auto& [alias, page] : _p_status_panes)
-				do_move_icons(page);
+				if (do_move_icons(page))
+					moved = true;
+
+			return moved;
 		}
 
 		/// The table view widget is constructed as follows:
 		/// 1. A special pane is made
 		/// 2. The table view is moved into the pane
-		void form::impl::move_tables() {
+		bool form::impl::move_tables() {
 			struct table_info {
 				std::string alias;
 
@@ -2341,6 +2464,8 @@ namespace liblec {
 				std::vector<table_info> tables;
 				helper::find_tables_to_move(page, tables);
 
+				bool moved = false;
+
 				// move the tables
 				for (auto& it : tables) {
 					log("moving table: " + it.alias + " from " + it.source._d_page.alias() + " to " + it.destination._d_page.alias());
@@ -2365,24 +2490,36 @@ namespace liblec {
 
 						// close widget
 						std::string error;
-						it.source._d_page.close_widget(it.alias, widgets::widget_type::table_view, error);
-						log("moving " + it.alias + " successful!");
+						if (it.source._d_page.close_widget(it.alias, widgets::widget_type::table_view, error)) {
+							log("moving " + it.alias + " successful!");
+							moved = true;
+						}
+						else
+							log("moving " + it.alias + " failed: " + error);
 					}
 					catch (const std::exception& e) { log("moving " + it.alias + " failed: " + e.what()); }
 				}
+
+				return moved;
 			};
 
+			bool moved = false;
+
 			// check if this page has tables to move and move them if they exist
 			auto page_iterator = _p_pages.find(_current_page);
 
 			if (page_iterator != _p_pages.end()) {
 				auto& page = page_iterator->second;
-				do_move_tables(page);
+				if (do_move_tables(page))
+					moved = true;
 			}
 
 			// check if status panes have tables and move them if they exist
 			for (auto& [alias, page] : _p_status_panes)
-				do_move_tables(page);
+				if (do_move_tables(page))
+					moved = true;
+
+			return moved;
 		}
 
 		/// If the application receives a WM_SIZE message, this method resizes the render target
@@ -2393,6 +2530,8 @@ namespace liblec {
 				/// error will be returned again the next time EndDraw is called
 				_p_render_target->Resize(D2D1::SizeU(width, height));
 			}
+
+			_full_repaint = true;
 		}
 
 		RECT form::impl::get_working_area(HWND hWnd) {
@@ -2772,6 +2911,57 @@ namespace liblec {
 			}
 		}
 
+		form::impl::widget_search_results
+			form::impl::find_widget(const std::string& path) {
+			auto it = _widget_index.find(path);
+
+			if (it != _widget_index.end())
+				return it->second;
+
+			// get the page alias
+			const auto idx = path.find("/");
+
+			if (idx == std::string::npos)
+				throw std::invalid_argument("Invalid path");
+
+			const auto page_alias = path.substr(0, idx);
+			const auto path_remaining = path.substr(idx + 1);
+
+			auto find = [&]() {
+				try {
+					// check form pages
+					return find_widget(_p_pages.at(page_alias), path_remaining);
+				}
+				catch (const std::exception&) {}
+
+				// check status panes
+				return find_widget(_p_status_panes.at(page_alias), path_remaining);
+			};
+
+			const auto result = find();
+			_widget_index.emplace(path, result);
+			return result;
+		}
+
+		form::impl::widget_search_results
+			form::impl::find_widget(widget_handle& handle) {
+			if (!handle._p_widget || handle._generation != _widget_index_generation) {
+				const auto result = find_widget(handle._path);
+				handle._p_widget = &result.widget;
+				handle._p_page = &result.page;
+				handle._generation = _widget_index_generation;
+			}
+
+			return widget_search_results{ *handle._p_widget, *handle._p_page };
+		}
+
+		void form::impl::clear_widget_index() {
+			// the widgets that were found may no longer exist, and the paths of those that were moved
+			// into special panes lead elsewhere
+			_widget_index.clear();
+			_widget_index_generation++;
+		}
+
 		containers::page&
 			form::impl::find_page(containers::page& container, const std::string& path) {
 			auto idx = path.find("/");
@@ -2837,37 +3027,14 @@ namespace liblec {
 			}
 		}
 
-		bool form::impl::enable(const std::string& path, bool enable, std::string& error) {
+		bool form::impl::enable(widget_handle& handle, bool enable, std::string& error) {
 			bool success = false;
 
 			try {
-				// get the page alias
-				const auto idx = path.find("/");
-
-				if (idx != std::string::npos) {
-					const auto page_alias = path.substr(0, idx);
-					const auto path_remaining = path.substr(idx + 1);
-
-					try {
-						// check form pages
-						auto result = find_widget(_p_pages.at(page_alias), path_remaining);
-						result.widget.enable(enable);
-						update();
-						success = true;
-					}
-					catch (const std::exception& e) { error = e.what(); }
-
-					if (!success) {
-						try {
-							// check status panes
-							auto result = find_widget(_p_status_panes.at(page_alias), path_remaining);
-							result.widget.enable(enable);
-							update();
-							success = true;
-						}
-						catch (const std::exception& e) { error = e.what(); }
-					}
-				}
+				auto result = find_widget(handle);
+				result.widget.enable(enable);
+				update();
+				success = true;
 			}
 			catch (const std::exception& e) { error = e.what(); }
 
@@ -2901,37 +3068,14 @@ namespace liblec {
 			return success;
 		}
 
-		bool form::impl::show(const std::string& path, bool show, std::string& error) {
+		bool form::impl::show(widget_handle& handle, bool show, std::string& error) {
 			bool success = false;
 
 			try {
-				// get the page alias
-				const auto idx = path.find("/");
-
-				if (idx != std::string::npos) {
-					const auto page_alias = path.substr(0, idx);
-					const auto path_remaining = path.substr(idx + 1);
-
-					try {
-						// check form pages
-						auto result = find_widget(_p_pages.at(page_alias), path_remaining);
-						result.widget.show(show);
-						update();
-						success = true;
-					}
-					catch (const std::exception& e) { error = e.what(); }
-
-					if (!success) {
-						try {
-							// check status pages
-							auto result = find_widget(_p_status_panes.at(page_alias), path_remaining);
-							result.widget.show(show);
-							update();
-							success = true;
-						}
-						catch (const std::exception& e) { error = e.what(); }
-					}
-				}
+				auto result = find_widget(handle);
+				result.widget.show(show);
+				update();
+				success = true;
 			}
 			catch (const std::exception& e) { error = e.what(); }
 
@@ -3027,6 +3171,7 @@ namespace liblec {
 
 									// close tab
 									tab_pane_impl.close_tab(tab_name);
+									clear_widget_index();
 									update();
 								}
 								else {
@@ -3041,6 +3186,7 @@ namespace liblec {
 
 									// close tab
 									tab_pane_impl.close_tab(tab_name);
+									clear_widget_index();
 									update();
 								}
 							}
@@ -3083,69 +3229,34 @@ namespace liblec {
 			}
 		}
 
-		void form::impl::select(const std::string& path) {
+		void form::impl::select(widget_handle& handle) {
 			try {
 				// get the page alias
-				const auto idx = path.find("/");
+				const auto idx = handle._path.find("/");
 
 				if (idx != std::string::npos) {
-					const auto page_alias = path.substr(0, idx);
-					const auto path_remaining = path.substr(idx + 1);
-
 					// clear selection in given page
-					clear_selection(_p_pages.at(page_alias));
-
-					try {
-						// check form pages
-						auto result = find_widget(_p_pages.at(page_alias), path_remaining);
-						result.widget.select(true);
-						update();
-					}
-					catch (const std::exception&) {}
+					clear_selection(_p_pages.at(handle._path.substr(0, idx)));
 
-					try {
-						// check status pages
-						auto result = find_widget(_p_status_panes.at(page_alias), path_remaining);
-						result.widget.select(true);
-						update();
-					}
-					catch (const std::exception&) {}
+					auto result = find_widget(handle);
+					result.widget.select(true);
+					update();
 				}
 			}
 			catch (const std::exception&) {}
 		}
 
-		bool form::impl::refresh(const std::string& path, std::string& error) {
+		bool form::impl::refresh(widget_handle& handle, std::string& error) {
 			bool success = false;
 
 			try {
-				// get the page alias
-				const auto idx = path.find("/");
+				auto result = find_widget(handle);
+				result.widget.discard_resources();
 
-				if (idx != std::string::npos) {
-					const auto page_alias = path.substr(0, idx);
-					const auto path_remaining = path.substr(idx + 1);
-
-					try {
-						// check form pages
-						auto result = find_widget(_p_pages.at(page_alias), path_remaining);
-						result.widget.discard_resources();
-						update();
-						success = true;
-					}
-					catch (const std::exception& e) { error = e.what(); }
-
-					if (!success) {
-						try {
-							// check status panes
-							auto result = find_widget(_p_status_panes.at(page_alias), path_remaining);
-							result.widget.discard_resources();
-							update();
-							success = true;
-						}
-						catch (const std::exception& e) { error = e.what(); }
-					}
-				}
+				// give images that failed to load another chance
+				_image_cache.forget_failures();
+				update();
+				success = true;
 			}
 			catch (const std::exception& e) { error = e.what(); }
 
@@ -3417,6 +3528,7 @@ namespace liblec {
 				return TRUE;
 
 			case WM_LBUTTONDOWN:
+				_form._d.flush_hittest();
 				_form._d._lbutton_pressed = true;
 				// capture the mouse
 				SetCapture(hWnd);
@@ -3424,6 +3536,8 @@ namespace liblec {
 				return NULL;
 
 			case WM_LBUTTONUP:
+				_form._d.flush_hittest();
+
 				// release the mouse capture
 				ReleaseCapture();
 				_form._d.on_lbuttonup(_form._d.get_cursor_position());
@@ -3431,10 +3545,12 @@ namespace liblec {
 				return NULL;
 
 			case WM_RBUTTONDOWN:
+				_form._d.flush_hittest();
 				_form._d.on_rbuttondown(_form._d.get_cursor_position());
 				return NULL;
 
 			case WM_RBUTTONUP:
+				_form._d.flush_hittest();
 				_form._d.on_rbuttonup(_form._d.get_cursor_position());
 				return NULL;
 
@@ -3460,11 +3576,12 @@ namespace liblec {
 
 			case WM_MOUSEMOVE:
 				_form._d._mouse_track.on_mouse_move(hWnd);
-				_form._d.client_hittest(_form._d.get_cursor_position());
+				_form._d.on_mousemove(_form._d.get_cursor_position());
 				return NULL;
 
 			case WM_MOUSELEAVE:
 				// _form._d.get_cursor_position() doesn't work here
+				_form._d._hittest_pending = false;
 				_form._d.client_hittest({ (float)LOWORD(lParam), (float)HIWORD(lParam) });
 				_form._d._mouse_track.reset(hWnd);
 				return NULL;
@@ -3510,16 +3627,32 @@ namespace liblec {
 				return NULL;
 
 			case WM_PAINT:
-				_form._d.move_trees();
-				_form._d.move_html_editors();
-				_form._d.move_times();
-				_form._d.move_dates();
-				_form._d.move_icons();
-				_form._d.move_tables();
+				if (_form._d._special_pane_moves_pending) {
+#if MOVECOUNT
+					static unsigned long long passes = 0;
+					log("special pane pass " + std::to_string(++passes));
+#endif
+					// each pass moves at most one widget of each kind per page, so keep passing on
+					// subsequent paints until a pass moves nothing. A move that fails is not
+					// retried, since it would only fail again on every paint
+					bool moved = false;
+
+					for (auto move : { &impl::move_trees, &impl::move_html_editors, &impl::move_times,
+						&impl::move_dates, &impl::move_icons, &impl::move_tables })
+						if ((_form._d.*move)())
+							moved = true;
+
+					_form._d._special_pane_moves_pending = moved;
+				}
+
 				_form._d.on_render();
 
-				if (_form._d._schedule_refresh)
+				if (_form._d._schedule_refresh) {
 					_form._d._schedule_refresh = false;
+
+					// the changes can be anywhere on the form
+					_form._d.update();
+				}
 				else
 					ValidateRect(hWnd, nullptr);
 
@@ -3623,10 +3756,12 @@ namespace liblec {
 				break;
 
 			case WM_MOUSEWHEEL:
+				_form._d.flush_hittest();
 				_form._d.on_wheel(wParam);
 				break;
 
 			case WM_MOUSEHWHEEL:
+				_form._d.flush_hittest();
 				_form._d.on_hwheel(wParam);
 				break;
 
@@ -3705,7 +3840,7 @@ namespace liblec {
 						std::string plain_label;
 						// parse the label
 						// the default color doesn't matter here we're just getting the plain text
-						std::vector<formatted_text_parser::text_range_properties> formatting;
+						std::shared_ptr<const formatted_text_parser::formatted_text_properties> formatting;
 						widgets::parse_formatted_text(m_it.label, plain_label,
 							D2D1::ColorF(D2D1::ColorF::Black), formatting);
 
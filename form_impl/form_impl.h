@@ -24,6 +24,7 @@
 #include "../widgets/control_buttons/minimize_button/minimize_button_impl.h"
 
 #include "../widgets/tooltip.h"
+#include "../widgets/image_view/image_cache.h"
 
 // Windows headers
 #include <Windows.h>
@@ -35,6 +36,7 @@
 // C++ STL headers
 #include <atomic>
 #include <memory>
+#include <unordered_map>
 
 namespace liblec {
 	namespace lecui {
@@ -96,12 +98,17 @@ namespace liblec {
 			const float _caption_icon_minimum_margin;
 			const float _caption_icon_maximum_size;
 			const std::string _receive_data_timer_alias;
+			const std::string _hittest_timer_alias;
+			const std::string _image_timer_alias;
 			const DWORD _current_thread_id;
 
 			// name of dll containing resources like PNGs etc
 			std::string _resource_dll_filename;
 			HMODULE _resource_module_handle;
 
+			// images shared by the form's widgets
+			image_cache _image_cache;
+
 			// icons for use by the Windows OS
 			int _idi_icon, _idi_icon_small;
 
@@ -166,6 +173,17 @@ namespace liblec {
 			D2D1_POINT_2F _point_before;
 			bool _user_sizing;
 
+			// mouse moves are hit tested at most once per timer tick, at the latest position
+			bool _hittest_pending;
+			D2D1_POINT_2F _hittest_point;
+
+			// set when widgets that live in special panes may need moving into them, so that
+			// paints only walk the pages looking for such widgets when there is work to do
+			bool _special_pane_moves_pending;
+
+			// set while the image cache's workers are decoding images for the widgets
+			bool _images_pending;
+
 			struct timer {
 				int unique_id = -1;
 				bool running = false;
@@ -209,6 +227,16 @@ namespace liblec {
 			/// widget from within the render method of another widget.</remarks>
 			bool _schedule_refresh;
 
+			/// <summary>The areas of the form, in DIPs, that have changed since the last render.
+			/// </summary>
+			/// <remarks>Widgets report their bounds here when only their own appearance changes,
+			/// e.g. on hover or when a caret blinks, so that the next render can be confined to
+			/// these areas. Ignored when _full_repaint is set.</remarks>
+			std::vector<D2D1_RECT_F> _dirty_rects;
+
+			/// <summary>Flag for forcing the next render to redraw the entire form.</summary>
+			bool _full_repaint;
+
 			bool _close_called;
 
 			bool _force_instance;
@@ -303,12 +331,15 @@ namespace liblec {
 			void create_form_caption();
 			void create_form_menu();
 			void update();
-			void move_trees();
-			void move_html_editors();
-			void move_times();
-			void move_dates();
-			void move_icons();
-			void move_tables();
+			void update(const D2D1_RECT_F& rect);
+			void watch_images();
+			void collect_images();
+			bool move_trees();
+			bool move_html_editors();
+			bool move_times();
+			bool move_dates();
+			bool move_icons();
+			bool move_tables();
 			HRESULT on_render();
 			void on_resize(UINT width, UINT height);
 			RECT get_working_area(HWND hWnd);
@@ -337,6 +368,8 @@ namespace liblec {
 			void on_rbuttondown(const D2D1_POINT_2F& point);
 			void on_rbuttonup(const D2D1_POINT_2F& point);
 			void client_hittest(const D2D1_POINT_2F& point);
+			void on_mousemove(const D2D1_POINT_2F& point);
+			void flush_hittest();
 			LRESULT non_client_hittest(const POINT& cursor);
 			void on_wheel(WPARAM wParam);
 			void on_hwheel(WPARAM wParam);
@@ -358,16 +391,23 @@ namespace liblec {
 				containers::page& page;
 			};
 
+			// widgets already found by their full path; cleared whenever a widget is closed
+			std::unordered_map<std::string, widget_search_results> _widget_index;
+			unsigned long long _widget_index_generation;
+
 			widget_search_results find_widget(containers::page& container, const std::string& path);
+			widget_search_results find_widget(const std::string& path);
+			widget_search_results find_widget(widget_handle& handle);
+			void clear_widget_index();
 			containers::page& find_page(containers::page& container, const std::string& path);
 
-			bool enable(const std::string& path, bool enable, std::string& error);
-			bool show(const std::string& path, bool show, std::string& error);
+			bool enable(widget_handle& handle, bool enable, std::string& error);
+			bool show(widget_handle& handle, bool show, std::string& error);
 			void close(const std::string& path);
 			void close_container(const std::string& path);
 			void clear_selection(containers::page& container);
-			void select(const std::string& path);
-			bool refresh(const std::string& path, std::string& error);
+			void select(widget_handle& handle);
+			bool refresh(widget_handle& handle, std::string& error);
 
 			lecui::size get_status_size(containers::status_pane_specs::pane_location type);
 			HWND find_native_handle(const std::string& guid);
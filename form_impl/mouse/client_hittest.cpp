@@ -9,10 +9,69 @@
 //
 
 #include "../form_impl.h"
+#include "../../utilities/timer.h"
+#include <algorithm>
+#include <chrono>
+
+#define HITTESTRATE	0	// set to 1 to log the number of mouse moves and hit tests every second, 0 otherwise
 
 namespace liblec {
 	namespace lecui {
+		void form::impl::on_mousemove(const D2D1_POINT_2F& point) {
+#if HITTESTRATE
+			static auto start = std::chrono::steady_clock::now();
+			static unsigned long moves = 0;
+			moves++;
+
+			if (std::chrono::steady_clock::now() - start >= std::chrono::seconds(1)) {
+				log("mouse moves per second: " + std::to_string(moves));
+				start = std::chrono::steady_clock::now();
+				moves = 0;
+			}
+#endif
+
+			_hittest_point = point;
+
+			if (_lbutton_pressed) {
+				// hit test every move while dragging so that scroll bars and sliders follow the
+				// mouse at full resolution
+				_hittest_pending = true;
+				flush_hittest();
+				return;
+			}
+
+			if (_hittest_pending)
+				return;	// a hit test is already scheduled and will use the latest position
+
+			// WM_TIMER is only generated when no other messages are waiting, so all the mouse
+			// moves that arrive before then are hit tested once
+			_hittest_pending = true;
+			timer_manager(_fm).add(_hittest_timer_alias, 0, [this]() { flush_hittest(); });
+		}
+
+		void form::impl::flush_hittest() {
+			timer_manager(_fm).stop(_hittest_timer_alias);
+
+			if (!_hittest_pending)
+				return;
+
+			_hittest_pending = false;
+			client_hittest(_hittest_point);
+		}
+
 		void form::impl::client_hittest(const D2D1_POINT_2F& point) {
+#if HITTESTRATE
+			static auto start = std::chrono::steady_clock::now();
+			static unsigned long hittests = 0;
+			hittests++;
+
+			if (std::chrono::steady_clock::now() - start >= std::chrono::seconds(1)) {
+				log("hit tests per second: " + std::to_string(hittests));
+				start = std::chrono::steady_clock::now();
+				hittests = 0;
+			}
+#endif
+
 			for (auto& [key, child] : _m_children) {
 				if (child && IsWindow(child->_d._hWnd) && child->_d._menu_form) {
 					// ignore mouse movement on parent, there is a menu form open
@@ -22,6 +81,7 @@ namespace liblec {
 
 			bool contains = false;
 			bool change = false;
+			widgets::widget_impl* p_widget_changed = nullptr;
 			HCURSOR h_cursor = nullptr;
 			std::function<void()> tooltip_func = nullptr;
 
@@ -52,25 +112,28 @@ namespace liblec {
 					}
 
 					if (!change) {
-						for (auto& widget : page._d_page.widgets()) {
-							if (widget.second.type() ==
+						// the containers are among the widgets placed everywhere in the grid
+						for (auto p_widget : page._d_page.grid().everywhere()) {
+							auto& widget = *p_widget;
+
+							if (widget.type() ==
 								widgets::widget_type::tab_pane) {
 								// get this tab pane
-								auto& tab_pane = page._d_page.get_tab_pane_impl(widget.first);
+								auto& tab_pane = page._d_page.get_tab_pane_impl(widget.alias());
 
 								for (auto& tab : tab_pane._p_tabs)
 									hittest_hscrollbar(tab.first, tab_pane.specs().selected(), tab.second,
-										point, point_before, contains, change, scroll_bar_hit, widget.second.visible());	// recursion
+										point, point_before, contains, change, scroll_bar_hit, widget.visible());	// recursion
 							}
 							else
-								if (widget.second.type() ==
+								if (widget.type() ==
 									widgets::widget_type::pane) {
 									// get this pane
-									auto& pane = page._d_page.get_pane_impl(widget.first);
+									auto& pane = page._d_page.get_pane_impl(widget.alias());
 
 									for (auto& page : pane._p_panes)
 										hittest_hscrollbar(page.first, pane._current_pane, page.second,
-											point, point_before, contains, change, scroll_bar_hit, widget.second.visible());	// recursion
+											point, point_before, contains, change, scroll_bar_hit, widget.visible());	// recursion
 								}
 						}
 					}
@@ -101,25 +164,28 @@ namespace liblec {
 					}
 
 					if (!change) {
-						for (auto& widget : page._d_page.widgets()) {
-							if (widget.second.type() ==
+						// the containers are among the widgets placed everywhere in the grid
+						for (auto p_widget : page._d_page.grid().everywhere()) {
+							auto& widget = *p_widget;
+
+							if (widget.type() ==
 								widgets::widget_type::tab_pane) {
 								// get this tab pane
-								auto& tab_pane = page._d_page.get_tab_pane_impl(widget.first);
+								auto& tab_pane = page._d_page.get_tab_pane_impl(widget.alias());
 
 								for (auto& tab : tab_pane._p_tabs)
 									hittest_vscrollbar(tab.first, tab_pane.specs().selected(), tab.second,
-										point, point_before, contains, change, scroll_bar_hit, widget.second.visible());	// recursion
+										point, point_before, contains, change, scroll_bar_hit, widget.visible());	// recursion
 							}
 							else
-								if (widget.second.type() ==
+								if (widget.type() ==
 									widgets::widget_type::pane) {
 									// get this pane
-									auto& pane = page._d_page.get_pane_impl(widget.first);
+									auto& pane = page._d_page.get_pane_impl(widget.alias());
 
 									for (auto& page : pane._p_panes)
 										hittest_vscrollbar(page.first, pane._current_pane, page.second,
-											point, point_before, contains, change, scroll_bar_hit, widget.second.visible());	// recursion
+											point, point_before, contains, change, scroll_bar_hit, widget.visible());	// recursion
 								}
 						}
 					}
@@ -127,66 +193,99 @@ namespace liblec {
 
 				static void hittest_widgets(containers::page& page,
 					const D2D1_POINT_2F& point, const bool& in_parent, bool& contains, bool& change, bool lbutton_pressed, HCURSOR& h_cursor, const bool& scroll_bar_hit,
-					std::function<void()>& tooltip_func) {
+					std::function<void()>& tooltip_func, widgets::widget_impl*& p_widget_changed) {
 					bool in_page = in_parent ? page._d_page.contains(point) : false;
 
+					// the widgets to visit: those that may be under the mouse and those it was over
+					// before. Every widget is visited while the left button is pressed since a pressed
+					// widget keeps following the mouse after it leaves the widget's rect.
+					std::vector<widgets::widget_impl*> candidates;
+
+					if (lbutton_pressed) {
+						candidates.reserve(page._d_page.widgets().size());
+
+						for (auto& widget : page._d_page.widgets())
+							candidates.push_back(&widget.second);
+					}
+					else {
+						const float dpi_scale = page._d_page.get_dpi_scale();
+						page._d_page.grid().candidates({ point.x / dpi_scale, point.y / dpi_scale }, candidates);
+
+						// visit them in the same order as the page's widgets
+						std::sort(candidates.begin(), candidates.end(),
+							[](widgets::widget_impl* a, widgets::widget_impl* b) { return a->alias() < b->alias(); });
+						candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+					}
+
 					// hit test widgets
-					for (auto& widget : page._d_page.widgets()) {
-						bool is_scroll_bar = (widget.second.type() ==
+					for (auto p_widget : candidates) {
+						auto& widget = *p_widget;
+
+						bool is_scroll_bar = (widget.type() ==
 							widgets::widget_type::h_scrollbar) ||
-							(widget.second.type() ==
+							(widget.type() ==
 								widgets::widget_type::v_scrollbar);
 
-						if (widget.second.is_static() || !widget.second.visible() || !widget.second.enabled())
+						if (widget.is_static() || !widget.visible() || !widget.enabled())
 							continue;
 
 						// failsafe: for good measure
 						if (lbutton_pressed)
-							widget.second.hide_tooltip();
+							widget.hide_tooltip();
 
 						if (change)
 							break;
 
-						contains = (in_page || is_scroll_bar || lbutton_pressed) ? widget.second.contains(point) : false;
+						contains = (in_page || is_scroll_bar || lbutton_pressed) ? widget.contains(point) : false;
 
 						if (!is_scroll_bar && scroll_bar_hit)
 							contains = false;
 
-						if (change = widget.second.hit(contains)) {
-							if (widget.second.hit()) h_cursor = widget.second.cursor();
+						if (change = widget.hit(contains)) {
+							p_widget_changed = p_widget;
+
+							if (widget.hit()) h_cursor = widget.cursor();
 
 							if (contains && !lbutton_pressed)
-								tooltip_func = [&]() { widget.second.show_tooltip(); };
+								tooltip_func = [p_widget]() { p_widget->show_tooltip(); };
 							else
-								widget.second.hide_tooltip();
+								widget.hide_tooltip();
 
 							break;
 						}
 
-						if (widget.second.type() ==
+						if (widget.type() ==
 							widgets::widget_type::tab_pane) {
 							// get this tab pane
-							auto& tab_pane = page._d_page.get_tab_pane_impl(widget.first);
+							auto& tab_pane = page._d_page.get_tab_pane_impl(widget.alias());
 
 							auto page_iterator = tab_pane._p_tabs.find(tab_pane.specs().selected());
 
 							if (page_iterator != tab_pane._p_tabs.end())
 								helper::hittest_widgets(page_iterator->second, point, in_page, contains, change, lbutton_pressed, h_cursor,
-									scroll_bar_hit, tooltip_func);	// recursion
+									scroll_bar_hit, tooltip_func, p_widget_changed);	// recursion
 						}
 						else
-							if (widget.second.type() ==
+							if (widget.type() ==
 								widgets::widget_type::pane) {
 								// get this pane
-								auto& pane = page._d_page.get_pane_impl(widget.first);
+								auto& pane = page._d_page.get_pane_impl(widget.alias());
 
 								auto page_iterator = pane._p_panes.find(pane._current_pane);
 
 								if (page_iterator != pane._p_panes.end())
 									helper::hittest_widgets(page_iterator->second, point, in_page, contains, change, lbutton_pressed, h_cursor,
-										scroll_bar_hit, tooltip_func);	// recursion
+										scroll_bar_hit, tooltip_func, p_widget_changed);	// recursion
 							}
 					}
+
+					// keep the widgets the mouse is over among the candidates until it leaves them
+					std::vector<widgets::widget_impl*> hot;
+					for (auto p_widget : candidates)
+						if (p_widget->hit())
+							hot.push_back(p_widget);
+
+					page._d_page.grid().hot(hot);
 				}
 			};
 
@@ -207,7 +306,7 @@ namespace liblec {
 			if (!change) {
 				for (auto& it : _p_status_panes)
 					helper::hittest_widgets(it.second, point, true, contains, change, _lbutton_pressed, h_cursor,
-						scroll_bar_hit, tooltip_func);
+						scroll_bar_hit, tooltip_func, p_widget_changed);
 			}
 
 			if (!change) {
@@ -215,7 +314,7 @@ namespace liblec {
 
 				if (page_iterator != _p_pages.end())
 					helper::hittest_widgets(page_iterator->second, point, true, contains, change, _lbutton_pressed, h_cursor,
-						scroll_bar_hit, tooltip_func);
+						scroll_bar_hit, tooltip_func, p_widget_changed);
 			}
 
 			if (!change) {
@@ -226,6 +325,8 @@ namespace liblec {
 
 					contains = widget.second.contains(point);
 					if (change = widget.second.hit(contains)) {
+						p_widget_changed = &widget.second;
+
 						if (contains)
 							tooltip_func = [&]() { widget.second.show_tooltip(); };
 						else
@@ -238,7 +339,11 @@ namespace liblec {
 
 			if (change) {
 				_h_widget_cursor = h_cursor;
-				update();
+
+				if (p_widget_changed && !_lbutton_pressed)
+					p_widget_changed->invalidate();	// only the hover state of the widget has changed
+				else
+					update();
 
 				if (tooltip_func)
 					tooltip_func();
@@ -9,8 +9,11 @@
 //
 
 #include "../form_impl.h"
+#include <chrono>
 
 #define DESIGNLINES	0	// set to 1 to show design lines, 0 otherwise
+#define RENDERCOUNT	0	// set to 1 to log the number of widgets drawn and culled in every frame, 0 otherwise
+#define FRAMERATE	0	// set to 1 to log the number of frames drawn every second, 0 otherwise
 
 namespace liblec {
 	namespace lecui {
@@ -28,13 +31,40 @@ namespace liblec {
 
 			HRESULT hr = S_OK;
 
+			// a newly created render target has no previous contents to retain
+			if (!_p_render_target)
+				_full_repaint = true;
+
 			hr = create_device_resources();
 
+			// work out the area that needs to be redrawn
+			const bool partial = !_full_repaint && !_dirty_rects.empty();
+			D2D1_RECT_F dirty_rect = { 0.f, 0.f, 0.f, 0.f };
+
+			if (partial) {
+				// include any area invalidated by the system, e.g. when an overlapping window is moved
+				RECT rc_update;
+				const bool system_update = GetUpdateRect(_hWnd, &rc_update, FALSE) != FALSE;
+				dirty_rect = dirty_area(_dirty_rects, system_update ? &rc_update : nullptr, _dpi_scale);
+			}
+
+			// whatever is reported from here on belongs to the next frame
+			_dirty_rects.clear();
+			_full_repaint = false;
+
+			const D2D1_RECT_F* p_dirty_rect = partial ? &dirty_rect : nullptr;
+			unsigned long widgets_drawn = 0;
+			unsigned long widgets_culled = 0;
+
 			if (SUCCEEDED(hr)) {
 				_p_render_target->BeginDraw();
 
 				_p_render_target->SetTransform(D2D1::Matrix3x2F::Identity());
 
+				// confine drawing to the area that needs to be redrawn
+				if (partial)
+					_p_render_target->PushAxisAlignedClip(dirty_rect, D2D1_ANTIALIAS_MODE_ALIASED);
+
 				// fill form background
 				_p_render_target->Clear(convert_color(_clr_background));
 
@@ -65,6 +95,28 @@ namespace liblec {
 
 				class helper {
 				public:
+					/// whether a widget is to be drawn in this frame. Widgets that are not drawn
+					/// are still positioned so that the layout stays intact.
+					static bool needs_render(widgets::widget_impl& widget,
+						const D2D1_RECT_F* p_visible_area, const D2D1_RECT_F* p_dirty_rect,
+						unsigned long& widgets_drawn, unsigned long& widgets_culled) {
+						bool culled = false;
+						const bool draw = widget_needs_render(widget.get_rect(), p_visible_area,
+							p_dirty_rect, culled);
+
+						// cull widgets that have been scrolled out of view
+						if (culled) {
+							widget.on_culled();
+							widgets_culled++;
+						}
+
+						if (!draw)
+							return false;
+
+						widgets_drawn++;
+						return true;
+					}
+
 					static void render_page(bool allow_render,
 						const std::string& page_alias,
 						const std::string& current_page,
@@ -72,17 +124,30 @@ namespace liblec {
 						ID2D1HwndRenderTarget* _p_render_target,
 						const D2D1_RECT_F& rectB,
 						const D2D1_RECT_F& client_area,
+						const D2D1_RECT_F& visible_area,
 						const D2D1_SIZE_F& change_in_size,
 						const D2D1_SIZE_F& resizing_change_in_size,
 						const float& _dpi_scale,
 						ID2D1SolidColorBrush* _p_brush_theme,
 						ID2D1SolidColorBrush* _p_brush_theme_hot,
-						bool lbutton_pressed, bool update_form) {
+						bool lbutton_pressed, bool update_form,
+						const D2D1_RECT_F* p_dirty_rect, unsigned long& widgets_drawn,
+						unsigned long& widgets_culled) {
 						bool render = page_alias == current_page;
 
 						if (!allow_render)
 							render = false;
 
+						// the part of the page that can be seen, i.e. the part of the client area that
+						// is within the visible area of the containers above it
+						D2D1_RECT_F visible = {
+							largest(client_area.left, visible_area.left),
+							largest(client_area.top, visible_area.top),
+							smallest(client_area.right, visible_area.right),
+							smallest(client_area.bottom, visible_area.bottom) };
+						visible.right = largest(visible.right, visible.left);
+						visible.bottom = largest(visible.bottom, visible.top);
+
 						// set the page as rendered, even if it's not being rendered to the screen
 						// here by render we're referring to in-memory rendering not on-screen rendering
 						page._d_page.rendered(true);
@@ -196,11 +261,10 @@ namespace liblec {
 										widgets::widget_type::group)
 										continue;
 
-									_rect_widgets = widget.render(_p_render_target,
+									_rect_widgets = widget.measure(_p_render_target,
 										resizing_change_in_size,
 										{ (page._d_page.h_scrollbar()._x_off_set / _dpi_scale) - client_area.left,
-										(page._d_page.v_scrollbar()._y_off_set / _dpi_scale) - client_area.top },
-										false);
+										(page._d_page.v_scrollbar()._y_off_set / _dpi_scale) - client_area.top });
 
 									if (!initialized) {
 										initialized = true;
@@ -252,55 +316,6 @@ namespace liblec {
 								break;
 							} while (true);
 
-							// resize groupboxes
-							for (auto& [alias, widget] : page._d_page.widgets()) {
-
-								if (widget.type() !=
-									widgets::widget_type::group)
-									continue;
-
-								try {
-									// get the groupbox widget
-									auto& specs = page._d_page.get_group_impl(alias).specs();
-
-									bool groupbox_initialized = false;
-									for (auto& widget_alias :
-										page._d_page.get_group_impl(alias).specs().widgets()) {
-										try {
-											// get the rect for this widget
-											const auto& _rect =
-												page._d_page.widgets().at(widget_alias).get_rect();
-
-											// adjust the groupbox rect
-											if (!groupbox_initialized) {
-												specs.rect(convert_rect(_rect));
-												groupbox_initialized = true;
-											}
-											else {
-												specs.rect()
-													.left(smallest(specs.rect().left(), _rect.left))
-													.top(smallest(specs.rect().top(), _rect.top))
-													.right(largest(specs.rect().right(), _rect.right))
-													.bottom(largest(specs.rect().bottom(), _rect.bottom));
-											}
-										}
-										catch (const std::exception&) {}
-									}
-
-									// apply the margin
-									specs.rect().left() -= specs.margin();
-									specs.rect().top() -= specs.margin();
-									specs.rect().right() += specs.margin();
-									specs.rect().bottom() += specs.margin();
-
-									// get bounding rect for all controls within this groupbox
-								}
-								catch (const std::exception&) {
-									// to-do: make sure rect is within bounding rects for page
-								}
-
-							}
-
 							// render groupboxes (in order)
 							for (auto& alias : page._d_page.widgets_order()) {
 								auto& widget = page._d_page.widgets().at(alias);
@@ -310,11 +325,9 @@ namespace liblec {
 									continue;
 
 								try {
-									// check if groupbox has widgets
-									if (page._d_page.get_group_impl(alias).specs().widgets().empty())
+									// fit the groupbox around its widgets, skipping it if none of them exist
+									if (!page._d_page.get_group_impl(alias).fit())
 										continue;
-
-									// to-do: check if widgets actually exist and discontinue if they dont
 								}
 								catch (const std::exception&) {
 									continue;
@@ -323,7 +336,10 @@ namespace liblec {
 								// render with no resizing or offset parameters because the rect for the
 								// group is already properly set
 								widget.render(_p_render_target,
-									{ 0.f, 0.f }, { 0.f, 0.f }, render);
+									{ 0.f, 0.f }, { 0.f, 0.f },
+									render && needs_render(widget, &visible, p_dirty_rect, widgets_drawn, widgets_culled));
+
+								page._d_page.place_in_grid(widget);
 							}
 
 							// render widgets (in order)
@@ -342,7 +358,9 @@ namespace liblec {
 									change_in_size,
 									{ (page._d_page.h_scrollbar()._x_off_set / _dpi_scale) - client_area.left,
 									(page._d_page.v_scrollbar()._y_off_set / _dpi_scale) - client_area.top },
-									render);
+									render && needs_render(widget, &visible, p_dirty_rect, widgets_drawn, widgets_culled));
+
+								page._d_page.place_in_grid(widget);
 
 								if (widget.type() ==
 									widgets::widget_type::tab_pane) {
@@ -374,8 +392,9 @@ namespace liblec {
 											rect_page.bottom -= _content_margin;
 
 											render_page(render ? tab_pane.visible() : false, tab.first, tab_pane.specs().selected(), tab.second,
-												_p_render_target, rect_page, rect_page, change_in_size, resizing_change_in_size,
-												_dpi_scale, _p_brush_theme, _p_brush_theme_hot, lbutton_pressed, update_form);	// recursion
+												_p_render_target, rect_page, rect_page, visible, change_in_size, resizing_change_in_size,
+												_dpi_scale, _p_brush_theme, _p_brush_theme_hot, lbutton_pressed, update_form,
+												p_dirty_rect, widgets_drawn, widgets_culled);	// recursion
 										}
 									}
 									catch (const std::exception&) {}
@@ -411,8 +430,9 @@ namespace liblec {
 												rect_page.bottom -= _content_margin;
 
 												render_page(render ? pane.visible() : false, page.first, pane._current_pane, page.second,
-													_p_render_target, rect_page, rect_page, change_in_size, resizing_change_in_size,
-													_dpi_scale, _p_brush_theme, _p_brush_theme_hot, lbutton_pressed, update_form);	// recursion
+													_p_render_target, rect_page, rect_page, visible, change_in_size, resizing_change_in_size,
+													_dpi_scale, _p_brush_theme, _p_brush_theme_hot, lbutton_pressed, update_form,
+													p_dirty_rect, widgets_drawn, widgets_culled);	// recursion
 											}
 										}
 										catch (const std::exception&) {}
@@ -432,13 +452,18 @@ namespace liblec {
 						page._d_page.h_scrollbar().setup(rectA, rectB);
 						page._d_page.h_scrollbar().render(_p_render_target,
 							resizing_change_in_size, { 0.f - client_area.left,
-							0.f - client_area.top }, render);
+							0.f - client_area.top },
+							render && needs_render(page._d_page.h_scrollbar(), &visible, p_dirty_rect, widgets_drawn, widgets_culled));
 
 						// setup vertical scroll bar and render it
 						page._d_page.v_scrollbar().setup(rectA, rectB);
 						page._d_page.v_scrollbar().render(_p_render_target,
 							resizing_change_in_size, { 0.f - client_area.left,
-							0.f - client_area.top }, render);
+							0.f - client_area.top },
+							render && needs_render(page._d_page.v_scrollbar(), &visible, p_dirty_rect, widgets_drawn, widgets_culled));
+
+						page._d_page.place_in_grid(page._d_page.h_scrollbar());
+						page._d_page.place_in_grid(page._d_page.v_scrollbar());
 
 						if (page._d_page.h_scrollbar()._programmatic_h_scroll) {
 							// capture scheduled scrolling value
@@ -477,8 +502,9 @@ namespace liblec {
 					const D2D1_RECT_F client_area = rect_page;
 
 					helper::render_page(true, page.first, _current_page, page.second, _p_render_target,
-						rect_page, client_area, change_in_size, change_in_size, _dpi_scale,
-						_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form);
+						rect_page, client_area, client_area, change_in_size, change_in_size, _dpi_scale,
+						_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form,
+						p_dirty_rect, widgets_drawn, widgets_culled);
 				}
 
 				// render status panes
@@ -493,8 +519,9 @@ namespace liblec {
 						const D2D1_RECT_F client_area = rect_page;
 
 						helper::render_page(true, page.first, page.first, page.second, _p_render_target,
-							rect_page, client_area, change_in_size, change_in_size, _dpi_scale,
-							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form);
+							rect_page, client_area, client_area, change_in_size, change_in_size, _dpi_scale,
+							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form,
+							p_dirty_rect, widgets_drawn, widgets_culled);
 					}
 
 					if (page.first == "status::top") {
@@ -507,8 +534,9 @@ namespace liblec {
 						const D2D1_RECT_F client_area = rect_page;
 
 						helper::render_page(true, page.first, page.first, page.second, _p_render_target,
-							rect_page, client_area, change_in_size, change_in_size, _dpi_scale,
-							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form);
+							rect_page, client_area, client_area, change_in_size, change_in_size, _dpi_scale,
+							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form,
+							p_dirty_rect, widgets_drawn, widgets_culled);
 					}
 
 					if (page.first == "status::left") {
@@ -521,8 +549,9 @@ namespace liblec {
 						const D2D1_RECT_F client_area = rect_page;
 
 						helper::render_page(true, page.first, page.first, page.second, _p_render_target,
-							rect_page, client_area, change_in_size, change_in_size, _dpi_scale,
-							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form);
+							rect_page, client_area, client_area, change_in_size, change_in_size, _dpi_scale,
+							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form,
+							p_dirty_rect, widgets_drawn, widgets_culled);
 					}
 
 					if (page.first == "status::right") {
@@ -535,8 +564,9 @@ namespace liblec {
 						const D2D1_RECT_F client_area = rect_page;
 
 						helper::render_page(true, page.first, page.first, page.second, _p_render_target,
-							rect_page, client_area, change_in_size, change_in_size, _dpi_scale,
-							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form);
+							rect_page, client_area, client_area, change_in_size, change_in_size, _dpi_scale,
+							_p_brush_theme, _p_brush_theme_hot, _lbutton_pressed, update_form,
+							p_dirty_rect, widgets_drawn, widgets_culled);
 					}
 				}
 
@@ -545,7 +575,8 @@ namespace liblec {
 					auto& widget = _widgets.at(alias);
 
 					widget.render(_p_render_target,
-						change_in_size, { 0.f, 0.f }, true);
+						change_in_size, { 0.f, 0.f },
+						helper::needs_render(widget, nullptr, p_dirty_rect, widgets_drawn, widgets_culled));
 				}
 
 				// render form border
@@ -556,7 +587,27 @@ namespace liblec {
 						_p_brush_theme, _form_border_thickness);
 				}
 
+				if (partial)
+					_p_render_target->PopAxisAlignedClip();
+
 				hr = _p_render_target->EndDraw();
+
+#if RENDERCOUNT
+				log("widgets drawn: " + std::to_string(widgets_drawn) + ", culled: " +
+					std::to_string(widgets_culled) + (partial ? " (partial)" : " (full)"));
+#endif
+
+#if FRAMERATE
+				static auto start = std::chrono::steady_clock::now();
+				static unsigned long frames = 0;
+				frames++;
+
+				if (std::chrono::steady_clock::now() - start >= std::chrono::seconds(1)) {
+					log("frames per second: " + std::to_string(frames));
+					start = std::chrono::steady_clock::now();
+					frames = 0;
+				}
+#endif
 			}
 
 			if (hr == D2DERR_RECREATE_TARGET) {
@@ -567,6 +618,9 @@ namespace liblec {
 			if (update_form)
 				update();
 
+			// widgets drawn in this frame may have asked for images to be decoded
+			watch_images();
+
 			return hr;
 		}
 	}
@@ -0,0 +1,765 @@
+//
+// formatted_text_document.cpp - formatted text document implementation
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#include "formatted_text_document.h"
+#include "formatted_text_editor.h"
+#include <string_view>
+#include <algorithm>
+
+/// preferred chunk size, and the size beyond which a chunk is split
+constexpr size_t chunk_size = 512;
+constexpr size_t max_chunk_size = 2 * chunk_size;
+
+/// returns the length of the tag that begins at offset, or 0 if there is no tag there
+size_t tag_length(const std::string& text, size_t offset) {
+	if (offset >= text.length() || text[offset] != '<')
+		return 0;
+
+	const auto close = text.find('>', offset + 1);
+	return close == std::string::npos ? 0 : close + 1 - offset;
+}
+
+/// returns the number of plaintext characters from offset up to the next tag
+size_t plain_run_length(const std::string& text, size_t offset) {
+	size_t length = 0;
+
+	while (offset + length < text.length()) {
+		const auto open = text.find('<', offset + length);
+
+		if (open == std::string::npos)
+			return text.length() - offset;
+
+		if (tag_length(text, open))
+			return open - offset;
+
+		length = open + 1 - offset;	// dangling '<', it's plaintext
+	}
+
+	return length;
+}
+
+void count_contents(const std::string& text, size_t& plain, size_t& tags) {
+	plain = 0;
+	tags = 0;
+
+	for (size_t i = 0; i < text.length();) {
+		const auto length = tag_length(text, i);
+
+		if (length) {
+			tags++;
+			i += length;
+		}
+		else {
+			plain++;
+			i++;
+		}
+	}
+}
+
+formatted_text_document::formatted_text_document() :
+	_length(0),
+	_plain_length(0),
+	_revision(1),
+	_xml_revision(0),
+	_checked_out_revision(0),
+	_checked_out(true),	// the external string is yet to be read
+	_clean(false),
+	_formatting_color({ 0.f, 0.f, 0.f, 0.f }),
+	_formatting_stale(true),
+	_formatting_revision(0) {
+	_chunks.push_back(chunk());
+	rebuild_index();
+
+	_gaps.push_back(0);
+	rebuild_gap_index();
+}
+
+void formatted_text_document::load(const std::string& xml_text) {
+	_chunks.clear();
+	_length = xml_text.length();
+	_plain_length = 0;
+	_gaps.clear();
+
+	chunk current;
+	size_t gap = 0;	// plaintext characters since the last tag
+
+	auto add_chunk = [&]() {
+		_plain_length += current.plain;
+		_chunks.push_back(std::move(current));
+		current = chunk();
+		current.text.reserve(chunk_size + chunk_size / 4);
+	};
+
+	current.text.reserve(chunk_size + chunk_size / 4);
+
+	for (size_t i = 0; i < xml_text.length();) {
+		const auto length = tag_length(xml_text, i);
+
+		if (length) {
+			current.text.append(xml_text, i, length);
+			current.tags++;
+			i += length;
+
+			_gaps.push_back(gap);
+			gap = 0;
+		}
+		else {
+			// copy plaintext up to the next tag, but not beyond the chunk size
+			const auto open = xml_text.find('<', i + 1);
+			const auto end = std::min(open == std::string::npos ? xml_text.length() : open,
+				i + std::max(chunk_size - std::min(current.text.length(), chunk_size), size_t(1)));
+
+			current.text.append(xml_text, i, end - i);
+			current.plain += end - i;
+			gap += end - i;
+			i = end;
+		}
+
+		if (current.text.length() >= chunk_size)
+			add_chunk();
+	}
+
+	if (!current.text.empty() || _chunks.empty())
+		add_chunk();
+
+	_gaps.push_back(gap);
+
+	rebuild_index();
+	rebuild_gap_index();
+	read_runs(xml_text);
+	_clean = false;
+	modified();
+}
+
+const std::string& formatted_text_document::xml() {
+	if (_xml_revision != _revision) {
+		_xml.clear();
+		_xml.reserve(_length);
+
+		for (const auto& it : _chunks)
+			_xml += it.text;
+
+		_xml_revision = _revision;
+	}
+
+	return _xml;
+}
+
+void formatted_text_document::check_out(std::string& xml_text) {
+	if (_checked_out_revision != _revision) {
+		xml_text = xml();
+		_checked_out_revision = _revision;
+	}
+
+	_checked_out = true;
+}
+
+void formatted_text_document::check_out() {
+	_checked_out = true;
+}
+
+bool formatted_text_document::sync(const std::string& xml_text) {
+	if (!_checked_out)
+		return false;
+
+	_checked_out = false;
+
+	if (xml_text == xml()) {
+		_checked_out_revision = _revision;
+		return false;
+	}
+
+	load(xml_text);
+	_checked_out_revision = _revision;
+	return true;
+}
+
+unsigned long long formatted_text_document::revision() const {
+	return _revision;
+}
+
+size_t formatted_text_document::length() const {
+	return _length;
+}
+
+size_t formatted_text_document::plain_length() const {
+	return _plain_length;
+}
+
+const std::string& formatted_text_document::plain_text() const {
+	return _plain;
+}
+
+const std::vector<formatted_text_parser::text_range_properties>&
+formatted_text_document::formatting(D2D1_COLOR_F default_color) {
+	if (_formatting_stale ||
+		default_color.r != _formatting_color.r || default_color.g != _formatting_color.g ||
+		default_color.b != _formatting_color.b || default_color.a != _formatting_color.a) {
+		_formatting.resize(_runs.size());
+
+		for (size_t i = 0; i < _runs.size(); i++)
+			formatted_text_parser::read_tag(_runs[i].tag, default_color, _formatting[i]);
+
+		_formatting_color = default_color;
+		_formatting_stale = false;
+		_formatting_revision = 0;
+	}
+
+	if (_formatting_revision != _revision) {
+		// only the positions of the tags may have changed
+		for (size_t i = 0; i < _runs.size(); i++) {
+			const auto start = tag_position(_runs[i].open_tag);
+			const auto end = tag_position(_runs[i].close_tag);
+			_formatting[i].text_range = { static_cast<UINT32>(start), static_cast<UINT32>(end - start) };
+		}
+
+		_formatting_revision = _revision;
+	}
+
+	return _formatting;
+}
+
+void formatted_text_document::insert_character(const char c, unsigned long position,
+	unsigned long tag_number) {
+	if (c == '<' || c == '>') {
+		// the character changes how the rest of the text is tokenized ... O(n)
+		auto xml_text = xml();
+		formatted_text_editor().insert_character(c, position, tag_number, xml_text);
+		load(xml_text);
+		return;
+	}
+
+	if (position > _plain_length)
+		return;
+
+	// find the position, and the number of tags before it
+	size_t tags = 0;
+	auto loc = locate(position, tags);
+
+	// of the tags right at the position, skip those that the tag number says precede the insertion
+	size_t skip = tag_number > tags ? tag_number - tags : 0;
+
+	while (skip && normalize(loc)) {
+		const auto length = tag_length(_chunks[loc.chunk].text, loc.offset);
+
+		if (!length)
+			break;
+
+		loc.offset += length;
+		tags++;
+		skip--;
+	}
+
+	auto& target = _chunks[loc.chunk];
+	target.text.insert(loc.offset, 1, c);
+	target.plain++;
+	_length++;
+	_plain_length++;
+	update_index(loc.chunk, 1, 0);
+
+	// the character goes into the plaintext between the tags before it and those after it
+	_plain.insert(position, 1, c);
+	update_gap(tags, 1);
+
+	if (target.text.length() > max_chunk_size)
+		split_chunk(loc.chunk);
+
+	modified();
+}
+
+unsigned long formatted_text_document::erase(unsigned long start, unsigned long end) {
+	unsigned long tag_number = 0;
+	size_t first_chunk = _chunks.size(), last_chunk = 0;	// the chunks that have been edited
+
+	if (start <= _plain_length) {
+		const auto end_requested = end;
+
+		if (end < start)
+			end = start;
+
+		if (end > _plain_length) {
+			// characters after the last tag are left alone, as does formatted_text_editor
+			size_t last_tag_position = start;
+
+			for (size_t i = _chunks.size(); i > 0; i--) {
+				const auto& it = _chunks[i - 1];
+
+				if (!it.tags)
+					continue;
+
+				// plaintext characters in this chunk before its last tag
+				size_t plain = 0, plain_before_last = 0;
+
+				for (size_t j = 0; j < it.text.length();) {
+					const auto length = tag_length(it.text, j);
+
+					if (length) {
+						plain_before_last = plain;
+						j += length;
+					}
+					else {
+						plain++;
+						j++;
+					}
+				}
+
+				last_tag_position = std::max(last_tag_position, plain_before(i - 1) + plain_before_last);
+				break;
+			}
+
+			end = static_cast<unsigned long>(last_tag_position);
+		}
+
+		size_t tags = 0;
+		const auto loc_start = locate(start, tags);
+		tag_number = static_cast<unsigned long>(tags);
+		size_t tags_passed = tags;	// the tags before the walk's current location
+
+		// when erasing from the very beginning, a tag that ends up at the same position as the
+		// tag before it is counted (as are tags at position 0), and everything else isn't
+		const bool walk_all = start == 0 && end_requested > _plain_length;
+		const size_t to_erase = end - start;
+		size_t erased = 0;
+		size_t previous_tag_position = 0;
+		auto loc = loc_start;
+
+		while (normalize(loc)) {
+			auto& current = _chunks[loc.chunk];
+			const auto length = tag_length(current.text, loc.offset);
+
+			if (length) {
+				const bool counted = start == 0 && erased == previous_tag_position;
+
+				if (erased == to_erase && !walk_all && !counted)
+					break;
+
+				if (counted)
+					tag_number++;
+
+				previous_tag_position = erased;
+				loc.offset += length;
+				tags_passed++;
+				continue;
+			}
+
+			if (erased == to_erase)
+				break;
+
+			// erase plaintext up to the next tag
+			const auto count = std::min(plain_run_length(current.text, loc.offset), to_erase - erased);
+			current.text.erase(loc.offset, count);
+			current.plain -= count;
+			_length -= count;
+			_plain_length -= count;
+			erased += count;
+			update_index(loc.chunk, -static_cast<long long>(count), 0);
+			update_gap(tags_passed, -static_cast<long long>(count));
+		}
+
+		_plain.erase(start, erased);
+		modified();
+
+		// the chunks that have been edited
+		first_chunk = loc_start.chunk;
+		last_chunk = loc.chunk;
+
+		// the tags between the start position and the erasure's end are now adjacent
+		if (_clean)
+			last_chunk = std::max(last_chunk, cleanup(loc_start, tags));
+	}
+	else
+		tag_number = static_cast<unsigned long>(tags_before(_chunks.size()));	// all the tags are before start
+
+	if (!_clean) {
+		// first erasure since the document was loaded ... cleanup the entire document, O(n)
+		auto xml_text = xml();
+		formatted_text_editor().cleanup(xml_text);
+
+		if (xml_text.length() != _length) {
+			load(xml_text);
+			last_chunk = first_chunk = _chunks.size();	// the chunks are new and none is empty
+		}
+
+		_clean = true;
+	}
+
+	compact(first_chunk, last_chunk);
+	return tag_number;
+}
+
+void formatted_text_document::toggle_tag(const std::string& tag_name,
+	const std::vector<xml_parser::tag_attribute>& tag_attributes,
+	unsigned long start, unsigned long end) {
+	// toggling is infrequent and restructures tags across the range, leave it to the editor ... O(n)
+	auto xml_text = xml();
+	formatted_text_editor().toggle_tag(xml_text, tag_name, tag_attributes, start, end);
+
+	if (xml_text != xml())
+		load(xml_text);
+}
+
+void formatted_text_document::toggle_tag(const std::string& tag_name,
+	unsigned long start, unsigned long end) {
+	std::vector<xml_parser::tag_attribute> tag_attributes;	// basic tags have no attributes
+	toggle_tag(tag_name, tag_attributes, start, end);
+}
+
+void formatted_text_document::modified() {
+	_revision++;
+}
+
+void formatted_text_document::rebuild_index() {
+	const auto n = _chunks.size();
+	_plain_index.assign(n + 1, 0);
+	_tag_index.assign(n + 1, 0);
+
+	for (size_t i = 1; i <= n; i++) {
+		_plain_index[i] += _chunks[i - 1].plain;
+		_tag_index[i] += _chunks[i - 1].tags;
+
+		const auto parent = i + (i & (~i + 1));
+
+		if (parent <= n) {
+			_plain_index[parent] += _plain_index[i];
+			_tag_index[parent] += _tag_index[i];
+		}
+	}
+}
+
+void formatted_text_document::update_index(size_t chunk, long long plain_delta,
+	long long tags_delta) {
+	for (auto i = chunk + 1; i < _plain_index.size(); i += i & (~i + 1)) {
+		_plain_index[i] = static_cast<size_t>(static_cast<long long>(_plain_index[i]) + plain_delta);
+		_tag_index[i] = static_cast<size_t>(static_cast<long long>(_tag_index[i]) + tags_delta);
+	}
+}
+
+size_t formatted_text_document::plain_before(size_t chunk) const {
+	size_t sum = 0;
+
+	for (auto i = chunk; i > 0; i -= i & (~i + 1))
+		sum += _plain_index[i];
+
+	return sum;
+}
+
+size_t formatted_text_document::tags_before(size_t chunk) const {
+	size_t sum = 0;
+
+	for (auto i = chunk; i > 0; i -= i & (~i + 1))
+		sum += _tag_index[i];
+
+	return sum;
+}
+
+void formatted_text_document::read_runs(const std::string& xml_text) {
+	auto info = xml_parser().read(xml_text);
+	_plain = std::move(info.plain_text);
+	_runs.clear();
+
+	for (auto& tag : info.tags) {
+		formatted_text_parser::text_range_properties properties;
+
+		if (!formatted_text_parser::read_tag(tag, { 0.f, 0.f, 0.f, 1.f }, properties))
+			continue;	// no bearing on the formatting
+
+		run r;
+		r.open_tag = tag.open_tag;
+		r.close_tag = tag.close_tag;
+		r.tag.name = std::move(tag.name);
+		r.tag.attributes = std::move(tag.attributes);
+		_runs.push_back(std::move(r));
+	}
+
+	_formatting_stale = true;
+}
+
+void formatted_text_document::rebuild_gap_index() {
+	const auto n = _gaps.size();
+	_gap_index.assign(n + 1, 0);
+
+	for (size_t i = 1; i <= n; i++) {
+		_gap_index[i] += _gaps[i - 1];
+
+		const auto parent = i + (i & (~i + 1));
+
+		if (parent <= n)
+			_gap_index[parent] += _gap_index[i];
+	}
+}
+
+void formatted_text_document::update_gap(size_t gap, long long delta) {
+	_gaps[gap] = static_cast<size_t>(static_cast<long long>(_gaps[gap]) + delta);
+
+	for (auto i = gap + 1; i < _gap_index.size(); i += i & (~i + 1))
+		_gap_index[i] = static_cast<size_t>(static_cast<long long>(_gap_index[i]) + delta);
+}
+
+size_t formatted_text_document::tag_position(size_t tag) const {
+	// the plaintext characters before the tag, i.e. in the gaps up to and including its own
+	size_t sum = 0;
+
+	for (auto i = tag + 1; i > 0; i -= i & (~i + 1))
+		sum += _gap_index[i];
+
+	return sum;
+}
+
+void formatted_text_document::remove_tags(const std::vector<size_t>& tags) {
+	if (tags.empty())
+		return;
+
+	// the plaintext before a removed tag now comes before the tag after it
+	std::vector<size_t> gaps;
+	gaps.reserve(_gaps.size() - tags.size());
+	size_t carry = 0;
+
+	for (size_t i = 0, r = 0; i < _gaps.size(); i++) {
+		if (r < tags.size() && tags[r] == i) {
+			carry += _gaps[i];
+			r++;
+			continue;
+		}
+
+		gaps.push_back(_gaps[i] + carry);
+		carry = 0;
+	}
+
+	_gaps = std::move(gaps);
+	rebuild_gap_index();
+
+	// drop the runs of the removed tags and renumber the rest
+	auto renumber = [&](size_t& tag) {
+		const auto it = std::lower_bound(tags.begin(), tags.end(), tag);
+
+		if (it != tags.end() && *it == tag)
+			return false;
+
+		tag -= static_cast<size_t>(it - tags.begin());
+		return true;
+	};
+
+	size_t kept = 0;
+
+	for (size_t i = 0; i < _runs.size(); i++) {
+		auto& r = _runs[i];
+		const bool open = renumber(r.open_tag);
+		const bool close = renumber(r.close_tag);
+
+		if (!open || !close)
+			continue;
+
+		if (kept != i)
+			_runs[kept] = std::move(r);
+
+		kept++;
+	}
+
+	if (kept != _runs.size()) {
+		_runs.resize(kept);
+		_formatting_stale = true;
+	}
+}
+
+void formatted_text_document::split_chunk(size_t index) {
+	auto& source = _chunks[index];
+
+	// find a tag boundary around the middle
+	size_t offset = 0;
+
+	while (offset < source.text.length() / 2) {
+		const auto length = tag_length(source.text, offset);
+		offset += length ? length : 1;
+	}
+
+	if (offset >= source.text.length())
+		return;
+
+	chunk second;
+	second.text = source.text.substr(offset);
+	source.text.erase(offset);
+
+	count_contents(source.text, source.plain, source.tags);
+	count_contents(second.text, second.plain, second.tags);
+
+	_chunks.insert(_chunks.begin() + index + 1, std::move(second));
+	rebuild_index();
+}
+
+formatted_text_document::location
+formatted_text_document::locate(size_t position, size_t& tags) const {
+	tags = 0;
+
+	if (position == 0)
+		return location();
+
+	// binary indexed tree search for the chunk with the position-th plaintext character
+	const auto n = _chunks.size();
+	size_t step = 1;
+
+	while (step * 2 <= n)
+		step *= 2;
+
+	size_t index = 0;
+	size_t remaining = position;
+
+	for (; step; step /= 2) {
+		if (index + step <= n && _plain_index[index + step] < remaining) {
+			index += step;
+			remaining -= _plain_index[index];
+		}
+	}
+
+	if (index >= n) {
+		// position is beyond the plaintext
+		tags = tags_before(n);
+		return { n - 1, _chunks[n - 1].text.length() };
+	}
+
+	tags = tags_before(index);
+
+	// walk the chunk to just after that character
+	const auto& text = _chunks[index].text;
+	size_t offset = 0;
+
+	while (remaining && offset < text.length()) {
+		const auto length = tag_length(text, offset);
+
+		if (length) {
+			tags++;
+			offset += length;
+		}
+		else {
+			offset++;
+			remaining--;
+		}
+	}
+
+	return { index, offset };
+}
+
+bool formatted_text_document::normalize(location& loc) const {
+	while (loc.offset >= _chunks[loc.chunk].text.length()) {
+		if (loc.chunk + 1 >= _chunks.size())
+			return false;
+
+		loc.chunk++;
+		loc.offset = 0;
+	}
+
+	return true;
+}
+
+/// assumes there is no whitespace in empty tags. first_tag is the number of the tag at loc, if
+/// any. Returns the last chunk visited.
+size_t formatted_text_document::cleanup(location loc, size_t first_tag) {
+	struct tag {
+		location loc;
+		size_t length = 0;
+		bool closing = false;
+		std::string_view name;
+		bool erase = false;
+	};
+
+	// gather the run of adjacent tags that starts at loc
+	std::vector<tag> run;
+
+	while (normalize(loc)) {
+		const auto& text = _chunks[loc.chunk].text;
+		const auto length = tag_length(text, loc.offset);
+
+		if (!length)
+			break;
+
+		tag t;
+		t.loc = loc;
+		t.length = length;
+		t.closing = text[loc.offset + 1] == '/';
+
+		std::string_view view(text.data() + loc.offset, length);
+
+		if (t.closing)
+			t.name = view.substr(2, length - 3);
+		else
+			t.name = view.substr(1, std::min(view.find(' '), length - 1) - 1);
+
+		run.push_back(t);
+		loc.offset += length;
+	}
+
+	// an opening tag immediately followed by its closing tag is an empty tag ... eliminate
+	// such pairs, including those that become adjacent as a result
+	std::vector<size_t> open;
+	bool changed = false;
+
+	for (size_t i = 0; i < run.size(); i++) {
+		if (run[i].closing && !open.empty() &&
+			!run[open.back()].closing && run[open.back()].name == run[i].name) {
+			run[open.back()].erase = true;
+			run[i].erase = true;
+			open.pop_back();
+			changed = true;
+		}
+		else
+			open.push_back(i);
+	}
+
+	const auto last_chunk = loc.chunk;
+
+	if (!changed)
+		return last_chunk;
+
+	// erase from the back so earlier locations remain valid
+	std::vector<size_t> erased;
+
+	for (size_t i = run.size(); i > 0; i--) {
+		const auto& t = run[i - 1];
+
+		if (!t.erase)
+			continue;
+
+		_chunks[t.loc.chunk].text.erase(t.loc.offset, t.length);
+		_chunks[t.loc.chunk].tags--;
+		_length -= t.length;
+		update_index(t.loc.chunk, 0, -1);
+		erased.push_back(first_tag + i - 1);
+	}
+
+	std::reverse(erased.begin(), erased.end());
+	remove_tags(erased);
+
+	modified();
+	return last_chunk;
+}
+
+/// removes the chunks in [first, last] that have been emptied
+void formatted_text_document::compact(size_t first, size_t last) {
+	if (_chunks.size() < 2 || first >= _chunks.size())
+		return;
+
+	const auto begin = _chunks.begin() + first;
+	const auto end = _chunks.begin() + std::min(last, _chunks.size() - 1) + 1;
+
+	if (begin >= end)
+		return;
+
+	const auto it = std::remove_if(begin, end,
+		[](const chunk& it) { return it.text.empty(); });
+
+	if (it == end)
+		return;
+
+	_chunks.erase(it, end);
+
+	if (_chunks.empty())
+		_chunks.push_back(chunk());
+
+	rebuild_index();
+}
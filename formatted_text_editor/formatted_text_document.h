@@ -0,0 +1,178 @@
+//
+// formatted_text_document.h - formatted text document interface
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../xml_parser/xml_parser.h"
+#include "../formatted_text_parser/formatted_text_parser.h"
+
+/// <summary>A document model for editing XML formatted text in place.</summary>
+/// <remarks>The formatted text is held in a rope of chunks that never split a tag. Every chunk
+/// keeps count of the plaintext characters and the tags within it, and binary indexed trees
+/// over these counts map plaintext positions to chunks in logarithmic time. Inserting and
+/// erasing therefore only touch the chunks at the edit position, and the XML string is only
+/// assembled when it is asked for. The results are identical to those of
+/// formatted_text_editor.
+///
+/// The plaintext and the formatting runs are kept up to date alongside the chunks, so that the
+/// text can be laid out without assembling or parsing the XML. A run refers to its opening and
+/// closing tags by number, and the tags' positions in the plaintext are held in a binary
+/// indexed tree over the plaintext between consecutive tags, which typing updates in
+/// logarithmic time.
+///
+/// Loading, toggling tags, inserting '&lt;' or '&gt;' and the cleanup of the whole document on
+/// the first erasure after loading are linear in the length of the document. Removing the tags
+/// that an erasure has left empty is linear in the number of tags.</remarks>
+class formatted_text_document {
+public:
+	formatted_text_document();
+
+	/// <summary>Replace the contents of the document.</summary>
+	/// <param name="xml_text">The XML formatted text.</param>
+	void load(const std::string& xml_text);
+
+	/// <summary>Get the XML formatted text.</summary>
+	/// <returns>The XML formatted text.</returns>
+	/// <remarks>The text is assembled at most once per revision.</remarks>
+	const std::string& xml();
+
+	/// <summary>Write the XML formatted text to an external string and hand that string over
+	/// to the caller, who may modify it.</summary>
+	/// <param name="xml_text">The string to write to. It is only written to if the document has
+	/// changed since it was last written to.</param>
+	void check_out(std::string& xml_text);
+
+	/// <summary>Hand the external string over to the caller, who may modify it.</summary>
+	void check_out();
+
+	/// <summary>Bring the document in line with the external string if it has been handed over
+	/// to the caller since the last call.</summary>
+	/// <param name="xml_text">The external string.</param>
+	/// <returns>Returns true if the document was reloaded, else false.</returns>
+	bool sync(const std::string& xml_text);
+
+	/// <summary>Get the revision of the document. The revision changes every time the document
+	/// is modified.</summary>
+	unsigned long long revision() const;
+
+	/// <summary>Get the length of the XML formatted text.</summary>
+	size_t length() const;
+
+	/// <summary>Get the length of the plaintext.</summary>
+	size_t plain_length() const;
+
+	/// <summary>Get the plaintext.</summary>
+	const std::string& plain_text() const;
+
+	/// <summary>Get the formatting of the plaintext.</summary>
+	/// <param name="default_color">The default color to use for the text.</param>
+	/// <returns>The text range properties, as formatted_text_parser would make them from the
+	/// XML formatted text.</returns>
+	/// <remarks>The properties are only made again when the tags or the default color have
+	/// changed. Otherwise only the ranges are brought up to date.</remarks>
+	const std::vector<formatted_text_parser::text_range_properties>&
+		formatting(D2D1_COLOR_F default_color);
+
+	/// <summary>Insert a character at a given position.</summary>
+	/// <param name="c">The character to insert.</param>
+	/// <param name="position">The position to insert the character (in reference to the
+	/// plaintext version).</param>
+	/// <param name="tag_number">The tag number after which to do the insertion.</param>
+	/// <remarks>Refer to formatted_text_editor::insert_character. Inserting '&lt;' or '&gt;'
+	/// changes how the rest of the text is read, and reloads the whole document.</remarks>
+	void insert_character(const char c, unsigned long position, unsigned long tag_number);
+
+	/// <summary>Erase some characters.</summary>
+	/// <param name="start">The start position, with reference to the plaintext.</param>
+	/// <param name="end">The end position, with reference to the plaintext.</param>
+	/// <returns>The tag number after which any new text can immediately be inserted after the
+	/// erasure.</returns>
+	/// <remarks>Refer to formatted_text_editor::erase.</remarks>
+	[[nodiscard]]
+	unsigned long erase(unsigned long start, unsigned long end);
+
+	/// <summary>For toggling tags, e.g. 'strong', 'em'.</summary>
+	/// <remarks>Refer to formatted_text_editor::toggle_tag. Toggling restructures the tags of
+	/// the whole document, so it is done on the XML and the document is reloaded.</remarks>
+	void toggle_tag(const std::string& tag_name,
+		const std::vector<xml_parser::tag_attribute>& tag_attributes,
+		unsigned long start, unsigned long end);
+
+	/// <summary>For toggling basic tags, e.g. 'strong', 'em'.</summary>
+	/// <remarks>Refer to formatted_text_editor::toggle_tag.</remarks>
+	void toggle_tag(const std::string& tag_name,
+		unsigned long start, unsigned long end);
+
+private:
+	/// <summary>A piece of the XML formatted text. Tags are never split across chunks.
+	/// </summary>
+	struct chunk {
+		std::string text;
+		size_t plain = 0;	// number of plaintext characters in the chunk
+		size_t tags = 0;	// number of tags in the chunk
+	};
+
+	/// <summary>A position within the XML formatted text.</summary>
+	struct location {
+		size_t chunk = 0;
+		size_t offset = 0;
+	};
+
+	/// <summary>A formatting run, i.e. an element whose opening tag has a matching closing
+	/// tag and whose name or attributes have a bearing on the formatting.</summary>
+	struct run {
+		size_t open_tag = 0;	// the number of tags before the opening tag
+		size_t close_tag = 0;	// the number of tags before the closing tag
+		xml_parser::tag tag;	// the element's name and attributes
+	};
+
+	std::vector<chunk> _chunks;
+	std::vector<size_t> _plain_index;	// binary indexed tree over chunk::plain
+	std::vector<size_t> _tag_index;		// binary indexed tree over chunk::tags
+	size_t _length;
+	size_t _plain_length;
+
+	std::string _plain;
+	std::vector<size_t> _gaps;			// plaintext characters before each tag and after the one before it, then those after the last tag
+	std::vector<size_t> _gap_index;		// binary indexed tree over _gaps
+	std::vector<run> _runs;				// in the order formatted_text_parser gives the formatting
+
+	unsigned long long _revision;
+	unsigned long long _xml_revision;
+	unsigned long long _checked_out_revision;
+	bool _checked_out;
+	bool _clean;
+	std::string _xml;
+
+	std::vector<formatted_text_parser::text_range_properties> _formatting;
+	D2D1_COLOR_F _formatting_color;
+	bool _formatting_stale;				// the runs have changed since _formatting was made
+	unsigned long long _formatting_revision;
+
+	void modified();
+	void rebuild_index();
+	void update_index(size_t chunk, long long plain_delta, long long tags_delta);
+	size_t plain_before(size_t chunk) const;
+	size_t tags_before(size_t chunk) const;
+	void split_chunk(size_t chunk);
+
+	void read_runs(const std::string& xml_text);
+	void rebuild_gap_index();
+	void update_gap(size_t gap, long long delta);
+	size_t tag_position(size_t tag) const;
+	void remove_tags(const std::vector<size_t>& tags);
+
+	location locate(size_t position, size_t& tags) const;
+	bool normalize(location& loc) const;
+	size_t cleanup(location loc, size_t first_tag);
+	void compact(size_t first, size_t last);
+};
@@ -10,280 +10,261 @@
 
 #include "formatted_text_parser.h"
 #include "../css_parser/css_parser.h"
-#include <sstream>
-#include <boost/lexical_cast.hpp>
-
-formatted_text_parser::formatted_text_properties
-formatted_text_parser::read(std::string formatted_text,
-	D2D1_COLOR_F default_color) {
-    formatted_text_properties properties;
-
-    // parse the formatted text into xml
-    properties.xml = xml_parser().read(formatted_text);
+#include <list>
+#include <mutex>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+/// the maximum number of entries in the formatted text cache
+constexpr size_t cache_capacity = 1024;
+
+/// formatted text longer than this is not cached, e.g. the contents of an html editor which
+/// change with every keystroke
+constexpr size_t cache_max_text_length = 4096;
+
+/// <summary>A cache of formatted text properties, keyed on the formatted text and the default
+/// color. The most recently used entries are at the front of the list.</summary>
+class formatted_text_cache {
+public:
+	struct key {
+		std::string_view text;	// a view into entry::text
+		D2D1_COLOR_F color;
+
+		bool operator==(const key& param) const {
+			return text == param.text &&
+				color.r == param.color.r && color.g == param.color.g &&
+				color.b == param.color.b && color.a == param.color.a;
+		}
+	};
 
-	auto parse_css_font_size = [](const std::string& text) {
-		float font_size = 0.f;
+	struct key_hash {
+		size_t operator()(const key& k) const {
+			size_t hash = std::hash<std::string_view>()(k.text);
 
-		try {
-			if (text.find("pt") != std::string::npos) {
-				// font size is described in points
-				std::stringstream ss;
-				ss << text;
-				ss >> font_size;
+			for (const float component : { k.color.r, k.color.g, k.color.b, k.color.a }) {
+				unsigned int bits = 0;
+				std::memcpy(&bits, &component, sizeof(bits));
+				hash ^= std::hash<unsigned int>()(bits) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
 			}
-			else
-				if (text.find("px") != std::string::npos) {
-					float pixels = 0.f;
-					// font size is described in pixels
-					std::stringstream ss;
-					ss << text;
-					ss >> pixels;
-
-					// to-do: convert from pixels to points
-				}
-				else {
-					// to-do: handle sizes that are described in neither points nor pixels
-				}
-		}
-		catch (const std::exception&) {}
 
-		return font_size;
+			return hash;
+		}
 	};
 
-	auto split_line = [](const std::string & line,
-		std::string seperator) {
-		std::vector<std::string> data;
-
-		auto add = [&](std::string s) {
-			// trim leading whitespace
-			s.erase(0, s.find_first_not_of(" "));
+	struct entry {
+		std::string text;
+		D2D1_COLOR_F color;
+		std::shared_ptr<const formatted_text_parser::formatted_text_properties> properties;
+	};
 
-			// trim trailing whitespace
-			s.erase(s.find_last_not_of(" ") + 1);
+	std::mutex mutex;
+	std::list<entry> entries;
+	std::unordered_map<key, std::list<entry>::iterator, key_hash> index;
+	formatted_text_parser::cache_statistics statistics;
+};
 
-			if (!s.empty())
-				data.push_back(s);
-		};
+formatted_text_cache& get_cache() {
+	static formatted_text_cache cache;
+	return cache;
+}
 
-		try {
-			data.clear();
+formatted_text_parser::formatted_text_properties
+formatted_text_parser::read(std::string formatted_text,
+	D2D1_COLOR_F default_color) {
+    formatted_text_properties properties;
 
-			std::string _line(line);
+    // parse the formatted text into xml
+    properties.xml = xml_parser().read(formatted_text);
 
-			while (true) {
-				auto idx = _line.find(seperator);
+	// make text_range_properties from the xml
+	for (auto& tag : properties.xml.tags) {
+		text_range_properties props;
 
-				if (idx == std::string::npos) {
-					add(_line);
-					break;
-				}
+		if (read_tag(tag, default_color, props))
+			properties.dwrite.push_back(props);
+	}
 
-				auto s = _line.substr(0, idx);
-				_line.erase(0, idx + 1);
-				add(s);
-			}
-		}
-		catch (const std::exception&) {}
+    return properties;
+}
 
-		return data;
+bool formatted_text_parser::read_tag(const xml_parser::tag& tag, D2D1_COLOR_F default_color,
+	text_range_properties& props) {
+	auto parse_css_color = [&](std::string_view text) {
+		css_parser::css_color color{ default_color.r, default_color.g, default_color.b, default_color.a };
+		css_parser::parse_color(text, color);
+		return D2D1_COLOR_F{ color.r, color.g, color.b, color.a };
 	};
 
-	auto parse_css_color = [&](std::string text) {
-		// make all text lower caps
-		for (auto& c : text)
-			c = tolower(c);
-
-		D2D1_COLOR_F color = default_color;
+	props = text_range_properties();
+	props.text_range.startPosition = tag.start_position;
+	props.text_range.length = tag.length;
 
-		try {
-			if (text.find("rgb") != std::string::npos) {
-				// color is described in rgb
-				
-				// trim opening brace
-				text.erase(0, text.find("(") + 1);
-
-				// trim trailing brace
-				text.erase(text.find(")"));
+	// handle strong tag
+	if (tag.name == "strong") {
+		props.bold = true;
+		return true;
+	}
 
-				const auto rgb = split_line(text, ",");
+	// handle emphasis tag
+	if (tag.name == "em") {
+		props.italic = true;
+		return true;
+	}
 
-				if (rgb.size() == 3) {
-					float r = 0.f, g = 0.f, b = 0.f;
+	// handle underline tag
+	if (tag.name == "u") {
+		props.underline = true;
+		return true;
+	}
 
-					std::stringstream ss;
-					ss << rgb[0];
-					ss >> r;
-					ss.clear();
+	// handle strikethrough tag
+	if (tag.name == "s") {
+		props.strikethrough = true;
+		return true;
+	}
 
-					ss << rgb[1];
-					ss >> g;
-					ss.clear();
+	// handle span tag
+	if (tag.name == "span") {
+		for (const auto& tag_attribute : tag.attributes) {
+			// handle CSS style attribute
+			if (tag_attribute.name == "style") {
+				std::string_view style_string(tag_attribute.value);
+				css_parser::css_declaration declaration;
+
+				while (css_parser::next(style_string, declaration)) {
+					// handle CSS style properties
+					switch (declaration.key) {
+					case css_parser::property_key::font_family:
+						props.font = declaration.value;
+						break;
+
+					case css_parser::property_key::font_size:
+						if (!css_parser::parse_font_size(declaration.value, props.font_size))
+							props.font_size = 0.f;
+						break;
+
+					case css_parser::property_key::font_weight:
+						props.bold = declaration.value == "bold";
+						break;
+
+					case css_parser::property_key::font_style:
+						props.italic = declaration.value == "italic";
+						break;
+
+					case css_parser::property_key::text_decoration:
+						if (declaration.value == "underline")
+							props.underline = true;
+						else
+							if (declaration.value == "line-through")
+								props.strikethrough = true;
+						break;
 
-					ss << rgb[2];
-					ss >> b;
-					ss.clear();
+					case css_parser::property_key::color:
+						props.color = parse_css_color(declaration.value);
+						break;
 
-					color.r = r / 255.f;
-					color.g = g / 255.f;
-					color.b = b / 255.f;
-					color.a = 1.f;
+					default:
+						break;
+					}
 				}
 			}
-			else
-				if (text.find("0x") != std::string::npos ||
-					text.find("#") != std::string::npos) {
-					// append missing
-					if (text[0] == '#') {
-						text.erase(0, 1);
-						text = "0x" + text;
-					}
+		}
+		return true;
+	}
 
-					for (size_t i = text.length(); i < 10; i++)
-						text += "f";
+	// handle our own in-house text tag
+	if (tag.name == "text") {
+		for (const auto& [key, value] : tag.attributes) {
+			if (key == "bold")
+				props.bold = value == "true";
+			else
+				if (key == "italic")
+					props.italic = value == "true";
+				else
+					if (key == "underline")
+						props.underline = value == "true";
+					else
+						if (key == "strikethrough")
+							props.strikethrough = value == "true";
+						else
+							if (key == "font")
+								props.font = value;
+							else
+								if (key == "size")
+									css_parser::parse_number(value, props.font_size);
+								else
+									if (key == "color")
+										props.color = parse_css_color(value);
+		}
 
-					// color is described in hexadecimal
-					std::stringstream ss;
-					ss << text;
+		return true;
+	}
 
-					unsigned long hex = 0;
-					ss >> std::hex >> hex;
+	return false;
+}
 
-					const auto r = boost::lexical_cast<float>((hex >> 24) & 0xff);
-					const auto g = boost::lexical_cast<float>((hex >> 16) & 0xff);
-					const auto b = boost::lexical_cast<float>((hex >> 8) & 0xff);
-					const auto a = boost::lexical_cast<float>((hex >> 0) & 0xff);
+std::shared_ptr<const formatted_text_parser::formatted_text_properties>
+formatted_text_parser::read_cached(const std::string& formatted_text,
+	D2D1_COLOR_F default_color) {
+	auto& cache = get_cache();
 
-					color.r = static_cast<float>(r) / 255.f;
-					color.g = static_cast<float>(g) / 255.f;
-					color.b = static_cast<float>(b) / 255.f;
-					color.a = static_cast<float>(a) / 255.f;
-				}
-				else {
-					// to-do: handle color that is described using a word, e.g. "red"
-				}
+	if (formatted_text.length() > cache_max_text_length) {
+		{
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			cache.statistics.misses++;
 		}
-		catch (const std::exception&) {}
-
-		return color;
-	};
 
-	// make text_range_properties from the xml
-	for (auto& tag : properties.xml.tags) {
-		text_range_properties props;
-		props.text_range.startPosition = tag.start_position;
-		props.text_range.length = tag.length;
+		return std::make_shared<const formatted_text_properties>(read(formatted_text, default_color));
+	}
 
-		// handle strong tag
-		if (tag.name == "strong") {
-			props.bold = true;
-			properties.dwrite.push_back(props);
-			continue;
-		}
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		auto it = cache.index.find({ formatted_text, default_color });
 
-		// handle emphasis tag
-		if (tag.name == "em") {
-			props.italic = true;
-			properties.dwrite.push_back(props);
-			continue;
+		if (it != cache.index.end()) {
+			// move to the front of the list
+			cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+			cache.statistics.hits++;
+			return it->second->properties;
 		}
 
-		// handle underline tag
-		if (tag.name == "u") {
-			props.underline = true;
-			properties.dwrite.push_back(props);
-			continue;
-		}
+		cache.statistics.misses++;
+	}
 
-		// handle strikethrough tag
-		if (tag.name == "s") {
-			props.strikethrough = true;
-			properties.dwrite.push_back(props);
-			continue;
-		}
+	// parse outside the lock
+	auto properties = std::make_shared<const formatted_text_properties>(read(formatted_text, default_color));
 
-		// handle span tag
-		if (tag.name == "span") {
-			for (const auto& tag_attribute : tag.attributes) {
-				// handle CSS style attribute
-				if (tag_attribute.name == "style") {
-					const auto properties = css_parser().read(tag_attribute.value);
-
-					for (const auto& css_property : properties) {
-						// handle CSS style properties
-						if (css_property.property == "font-family") {
-							props.font = css_property.value;
-							continue;
-						}
-
-						if (css_property.property == "font-size") {
-							props.font_size = parse_css_font_size(css_property.value);
-							continue;
-						}
-
-						if (css_property.property == "font-weight") {
-							props.bold = css_property.value == "bold";
-							continue;
-						}
-
-						if (css_property.property == "font-style") {
-							props.italic = css_property.value == "italic";
-							continue;
-						}
-
-						if (css_property.property == "text-decoration") {
-							if (css_property.value == "underline") {
-								props.underline = true;
-								continue;
-							}
-							if (css_property.value == "line-through") {
-								props.strikethrough = true;
-								continue;
-							}
-							continue;
-						}
-
-						if (css_property.property == "color") {
-							props.color = parse_css_color(css_property.value);
-							continue;
-						}
-					}
-				}
-			}
-			properties.dwrite.push_back(props);
-			continue;
-		}
+	std::lock_guard<std::mutex> lock(cache.mutex);
 
-		// handle our own in-house text tag
-		if (tag.name == "text") {
-			for (const auto& [key, value] : tag.attributes) {
-				if (key == "bold")
-					props.bold = value == "true";
-				else
-					if (key == "italic")
-						props.italic = value == "true";
-					else
-						if (key == "underline")
-							props.underline = value == "true";
-						else
-							if (key == "strikethrough")
-								props.strikethrough = value == "true";
-							else
-								if (key == "font")
-									props.font = value;
-								else
-									if (key == "size") {
-										try { props.font_size = boost::lexical_cast<float>(value); }
-										catch (const std::exception&) {}
-									}
-									else
-										if (key == "color")
-											props.color = parse_css_color(value);
-			}
+	if (cache.index.find({ formatted_text, default_color }) == cache.index.end()) {
+		cache.entries.push_front({ formatted_text, default_color, properties });
+		const auto& front = cache.entries.front();
+		cache.index.emplace(formatted_text_cache::key{ front.text, front.color }, cache.entries.begin());
 
-			properties.dwrite.push_back(props);
-			continue;
+		// evict the least recently used entry
+		if (cache.entries.size() > cache_capacity) {
+			const auto& back = cache.entries.back();
+			cache.index.erase({ back.text, back.color });
+			cache.entries.pop_back();
 		}
 	}
 
-    return properties;
+	return properties;
+}
+
+formatted_text_parser::cache_statistics formatted_text_parser::statistics() {
+	auto& cache = get_cache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	auto statistics = cache.statistics;
+	statistics.entries = cache.entries.size();
+	return statistics;
+}
+
+void formatted_text_parser::clear_cache() {
+	auto& cache = get_cache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.index.clear();
+	cache.entries.clear();
+	cache.statistics = {};
 }
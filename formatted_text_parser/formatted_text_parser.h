@@ -12,6 +12,7 @@
 
 #include <dwrite.h>
 #include <string>
+#include <memory>
 #include <d2d1.h>
 
 #include "../xml_parser/xml_parser.h"
@@ -49,4 +50,44 @@ public:
 	[[nodiscard]]
 	formatted_text_properties read(std::string formatted_text,
 		D2D1_COLOR_F default_color);
+
+	/// <summary>Make the text range properties of a single tag.</summary>
+	/// <param name="tag">The tag, as read by xml_parser.</param>
+	/// <param name="default_color">The default color to use for the text.</param>
+	/// <param name="properties">The properties, covering the tag's text.</param>
+	/// <returns>Returns false if the tag has no bearing on the formatting, e.g. an unknown tag.
+	/// </returns>
+	static bool read_tag(const xml_parser::tag& tag, D2D1_COLOR_F default_color,
+		text_range_properties& properties);
+
+	/// <summary>Read formatted text, reusing the results of earlier reads of the same text.
+	/// </summary>
+	/// <param name="formatted_text">The XML or HTML formatted text.</param>
+	/// <param name="default_color">The default color to use for the text.</param>
+	/// <returns>The formatted text properties. These are shared with other readers of the same
+	/// text and must not be modified.</returns>
+	/// <remarks>The cache is shared by all instances of this class and holds a bounded number of
+	/// the most recently used entries.</remarks>
+	[[nodiscard]]
+	std::shared_ptr<const formatted_text_properties> read_cached(const std::string& formatted_text,
+		D2D1_COLOR_F default_color);
+
+	/// <summary>Formatted text cache statistics.</summary>
+	struct cache_statistics {
+		/// <summary>The number of reads that were served from the cache.</summary>
+		unsigned long long hits = 0;
+
+		/// <summary>The number of reads that had to parse the formatted text.</summary>
+		unsigned long long misses = 0;
+
+		/// <summary>The number of entries currently in the cache.</summary>
+		size_t entries = 0;
+	};
+
+	/// <summary>Get the formatted text cache statistics.</summary>
+	/// <returns>The statistics.</returns>
+	static cache_statistics statistics();
+
+	/// <summary>Empty the formatted text cache and reset the statistics.</summary>
+	static void clear_cache();
 };
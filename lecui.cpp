@@ -561,7 +561,10 @@ namespace liblec {
 		}
 
 		int get::integer(const std::any& value) {
-			return std::any_cast<int>(value);
+			if (value.type() == typeid(long long))
+				return static_cast<int>(std::any_cast<long long>(value));
+			else
+				return std::any_cast<int>(value);
 		}
 
 		double get::real(const std::any& value) {
@@ -48,6 +48,8 @@
 #include <vector>
 #include <map>
 #include <any>
+#include <memory>
+#include <functional>
 
 /// <summary>Top level namespace for the liblec libraries.</summary>
 namespace liblec {
@@ -874,6 +876,343 @@ namespace liblec {
 		/// </summary>
 		using table_row = std::map<std::string, std::any>;
 
+#if defined(LECUI_EXPORTS)
+		namespace widgets {
+			class table_view_impl;
+			class tree_view_impl;
+		}
+#endif
+
+		/// <summary>Columnar table data. Each column is a contiguous array of a single type
+		/// and cells are addressed by row and column index.</summary>
+		/// <remarks>Text is interned, so every distinct string is stored only once. Reading a
+		/// cell takes constant time and a row costs 8 bytes for every integer or real column,
+		/// 4 bytes for every text column and a bit per cell to mark empty cells. Prefer this to
+		/// a vector of <see cref="table_row"></see> for large tables. Methods that are given a
+		/// row or column that doesn't exist throw std::out_of_range, and those that are given a
+		/// column of the wrong type throw std::invalid_argument.</remarks>
+		class lecui_api table_data {
+		public:
+			/// <summary>The type of the values in a column.</summary>
+			enum class column_type {
+				/// <summary>64-bit integers.</summary>
+				integer,
+
+				/// <summary>Double precision real numbers.</summary>
+				real,
+
+				/// <summary>Text.</summary>
+				text,
+			};
+
+			/// <summary>Constructor.</summary>
+			table_data();
+
+			/// <summary>Copy constructor.</summary>
+			/// <param name="param">The table data to copy.</param>
+			table_data(const table_data& param);
+
+			/// <summary>Copy table data.</summary>
+			/// <param name="param">The table data to copy.</param>
+			/// <returns>Returns a reference to the copy.</returns>
+			table_data& operator=(const table_data& param);
+			~table_data();
+
+			/// <summary>Remove all the rows and columns.</summary>
+			void clear();
+
+			/// <summary>Add a column.</summary>
+			/// <param name="name">The name of the column, as used in <see cref="table_column"></see>.</param>
+			/// <param name="type">The type of the values in the column.</param>
+			/// <returns>The index of the column.</returns>
+			/// <remarks>The column is empty in every existing row. If there is already a column with
+			/// the same name its index is returned and its type is left as is.</remarks>
+			size_t add_column(const std::string& name, const column_type& type);
+
+			/// <summary>Get the number of columns.</summary>
+			size_t columns() const;
+
+			/// <summary>Find a column.</summary>
+			/// <param name="name">The name of the column.</param>
+			/// <returns>The index of the column, or -1 if there is no such column.</returns>
+			long find_column(const std::string& name) const;
+
+			/// <summary>Get the name of a column.</summary>
+			/// <param name="column">The index of the column.</param>
+			const std::string& column_name(const size_t& column) const;
+
+			/// <summary>Get the type of the values in a column.</summary>
+			/// <param name="column">The index of the column.</param>
+			column_type type(const size_t& column) const;
+
+			/// <summary>Get the number of rows.</summary>
+			size_t rows() const;
+
+			/// <summary>Reserve space for rows that are yet to be added.</summary>
+			/// <param name="rows">The total number of rows expected.</param>
+			void reserve(const size_t& rows);
+
+			/// <summary>Add a row. All the cells of the new row are empty.</summary>
+			/// <returns>The index of the row.</returns>
+			size_t add_row();
+
+			/// <summary>Check whether a cell is empty.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <returns>Returns true if the cell has not been given a value, else false.</returns>
+			bool empty(const size_t& row, const size_t& column) const;
+
+			/// <summary>Empty a cell.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <returns>A reference to the modified object.</returns>
+			table_data& clear(const size_t& row, const size_t& column);
+
+			/// <summary>Get the value of a cell in an integer column.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <returns>The value, or 0 if the cell is empty.</returns>
+			long long integer(const size_t& row, const size_t& column) const;
+
+			/// <summary>Set the value of a cell in an integer column.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <param name="value">The value.</param>
+			/// <returns>A reference to the modified object.</returns>
+			table_data& integer(const size_t& row, const size_t& column, const long long& value);
+
+			/// <summary>Get the value of a cell in a real column.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <returns>The value, or 0.0 if the cell is empty.</returns>
+			double real(const size_t& row, const size_t& column) const;
+
+			/// <summary>Set the value of a cell in a real column.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <param name="value">The value.</param>
+			/// <returns>A reference to the modified object.</returns>
+			table_data& real(const size_t& row, const size_t& column, const double& value);
+
+			/// <summary>Get the value of a cell in a text column.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <returns>The text, which is blank if the cell is empty.</returns>
+			const std::string& text(const size_t& row, const size_t& column) const;
+
+			/// <summary>Set the value of a cell in a text column.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <param name="value">The text.</param>
+			/// <returns>A reference to the modified object.</returns>
+			table_data& text(const size_t& row, const size_t& column, const std::string& value);
+
+			/// <summary>Get a row in the form of a <see cref="table_row"></see>.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <returns>The row. Integers are given as long long, real numbers as double and text
+			/// as std::string, so they can be read using the <see cref="get"></see> helper. Numbers
+			/// that were assigned to a text column are given as numbers. Empty cells are left out.
+			/// </returns>
+			table_row row(const size_t& row) const;
+
+			/// <summary>Replace the contents with a list of <see cref="table_row"></see>.</summary>
+			/// <param name="data">The rows.</param>
+			/// <remarks>A column is made for every column name in the rows, and its type is
+			/// taken from the first value under that name. Integers under a real column are
+			/// converted, and an integer column is widened to a real one when a real number is
+			/// found under it. Any other mix of types makes a text column, whose numbers are still
+			/// shown as numbers. Values of other types are left out.</remarks>
+			void assign(const std::vector<table_row>& data);
+
+		private:
+			class impl;
+			impl& _d;
+
+#if defined(LECUI_EXPORTS)
+			/// <summary>Get the text to display in a cell.</summary>
+			/// <param name="row">The index of the row.</param>
+			/// <param name="column">The index of the column.</param>
+			/// <param name="precision">The number of decimal places for real numbers.</param>
+			/// <returns>The text. The reference is valid until the next call.</returns>
+			/// <remarks>Text is converted once per distinct string and numbers are written to a
+			/// reused buffer, so once the buffers are warm this doesn't allocate.</remarks>
+			const std::wstring& display_text(const size_t& row, const size_t& column,
+				const int& precision) const;
+
+			/// <summary>A column to sort the rows by.</summary>
+			struct sort_column {
+				size_t column = 0;
+				bool ascending = true;
+			};
+
+			/// <summary>The strings of a text sort column, to be ranked by rank_text.</summary>
+			struct text_keys {
+				size_t block = 0;	// the column's block of keys
+				bool ascending = true;
+				std::vector<std::string> strings;	// the distinct strings in the column
+			};
+
+			/// <summary>Extract the keys for sorting the rows.</summary>
+			/// <param name="columns">The columns to sort by, the most significant first.</param>
+			/// <param name="keys">The keys; a block of one key per row for every sort column, in
+			/// the order of the columns. Comparing keys as unsigned integers gives the order of the
+			/// rows once rank_text has been called.</param>
+			/// <param name="texts">The strings of the text columns among the sort columns.</param>
+			/// <remarks>Empty cells come first in ascending order and last in descending order. The
+			/// two smallest 64-bit integers are given the same key. Only the strings that are in the
+			/// text columns are copied, and they are compared by rank_text, so that the comparing
+			/// can be done on another thread.</remarks>
+			void sort_keys(const std::vector<sort_column>& columns,
+				std::vector<unsigned long long>& keys, std::vector<text_keys>& texts) const;
+
+			/// <summary>Rank the strings of the text sort columns and complete their keys.</summary>
+			/// <param name="texts">The strings, as given by sort_keys.</param>
+			/// <param name="rows">The number of rows.</param>
+			/// <param name="keys">The keys, as given by sort_keys.</param>
+			/// <remarks>Doesn't touch the table data, so it can be done on another thread.</remarks>
+			static void rank_text(const std::vector<text_keys>& texts, const size_t& rows,
+				std::vector<unsigned long long>& keys);
+
+			/// <summary>Work out the order of the rows from their sort keys.</summary>
+			/// <param name="keys">The keys, as given by sort_keys.</param>
+			/// <param name="rows">The number of rows.</param>
+			/// <param name="order">The row indices, in sorted order.</param>
+			/// <remarks>The sort is stable and runs in parallel. It only reads the keys, so it can
+			/// be done on another thread while the table data is in use.</remarks>
+			static void sort_order(const std::vector<unsigned long long>& keys, const size_t& rows,
+				std::vector<size_t>& order);
+
+			/// <summary>Rearrange the rows.</summary>
+			/// <param name="order">The row indices in the new order, as given by sort_order.</param>
+			void reorder(const std::vector<size_t>& order);
+
+			friend class widgets::table_view_impl;
+#endif
+		};
+
+		/// <summary>Tree data. Nodes are kept in a single contiguous store and are referred to
+		/// by handles, which are indices that stay valid until the node is removed or the data is
+		/// cleared. The handles of removed nodes are reused by nodes added later.</summary>
+		/// <remarks>Children keep the order in which they are added unless they are sorted, and
+		/// every distinct name is stored only once. Copies share the nodes until one of them is
+		/// changed, so copying takes constant time. Methods that are given a handle that doesn't
+		/// exist throw std::out_of_range.</remarks>
+		class lecui_api tree_data {
+		public:
+			/// <summary>The handle used for the (invisible) parent of the top level nodes, and
+			/// returned when there is no such node.</summary>
+			static constexpr size_t none = static_cast<size_t>(-1);
+
+			/// <summary>Constructor.</summary>
+			tree_data();
+
+			/// <summary>Copy constructor.</summary>
+			/// <param name="param">The tree data to copy.</param>
+			tree_data(const tree_data& param);
+
+			/// <summary>Copy tree data.</summary>
+			/// <param name="param">The tree data to copy.</param>
+			/// <returns>Returns a reference to the copy.</returns>
+			tree_data& operator=(const tree_data& param);
+			~tree_data();
+
+			/// <summary>Remove all the nodes.</summary>
+			void clear();
+
+			/// <summary>Get the number of nodes.</summary>
+			size_t size() const;
+
+			/// <summary>Check whether a node exists.</summary>
+			/// <param name="node">The handle of the node.</param>
+			/// <returns>Returns true if the node exists, false if it never did or has been removed.
+			/// </returns>
+			bool contains(const size_t& node) const;
+
+			/// <summary>Reserve space for nodes that are yet to be added.</summary>
+			/// <param name="nodes">The total number of nodes expected.</param>
+			void reserve(const size_t& nodes);
+
+			/// <summary>Add a node after the existing children of a parent.</summary>
+			/// <param name="parent">The handle of the parent, or <see cref="none"></see> for a
+			/// top level node.</param>
+			/// <param name="name">The name of the node.</param>
+			/// <returns>The handle of the new node.</returns>
+			size_t add(const size_t& parent, const std::string& name);
+
+			/// <summary>Get the name of a node.</summary>
+			/// <param name="node">The handle of the node.</param>
+			const std::string& name(const size_t& node) const;
+
+			/// <summary>Get the parent of a node.</summary>
+			/// <param name="node">The handle of the node.</param>
+			/// <returns>The handle of the parent, or <see cref="none"></see> for a top level node.</returns>
+			size_t parent(const size_t& node) const;
+
+			/// <summary>Get the first child of a node.</summary>
+			/// <param name="node">The handle of the node, or <see cref="none"></see> for the first
+			/// top level node.</param>
+			/// <returns>The handle of the child, or <see cref="none"></see> if there isn't any.</returns>
+			size_t first_child(const size_t& node) const;
+
+			/// <summary>Get the next sibling of a node.</summary>
+			/// <param name="node">The handle of the node.</param>
+			/// <returns>The handle of the sibling, or <see cref="none"></see> if there isn't any.</returns>
+			size_t next_sibling(const size_t& node) const;
+
+			/// <summary>Check whether a node's children are shown.</summary>
+			/// <param name="node">The handle of the node.</param>
+			bool expand(const size_t& node) const;
+
+			/// <summary>Set whether to show a node's children.</summary>
+			/// <param name="node">The handle of the node.</param>
+			/// <param name="expand">Whether to show the children.</param>
+			/// <returns>A reference to the modified object.</returns>
+			tree_data& expand(const size_t& node, const bool& expand);
+
+			/// <summary>Check whether a node has children that are yet to be added.</summary>
+			/// <param name="node">The handle of the node.</param>
+			bool children_pending(const size_t& node) const;
+
+			/// <summary>Set whether a node has children that are yet to be added. The expand marker
+			/// is drawn for such a node, and its children are expected to be added in the tree
+			/// view's node_data_expand event.</summary>
+			/// <param name="node">The handle of the node.</param>
+			/// <param name="children_pending">Whether the node has children to be added.</param>
+			/// <returns>A reference to the modified object.</returns>
+			tree_data& children_pending(const size_t& node, const bool& children_pending);
+
+			/// <summary>Remove the children of a node, and all their descendants.</summary>
+			/// <param name="node">The handle of the node, or <see cref="none"></see> for all the
+			/// nodes.</param>
+			/// <remarks>The handles of the removed nodes become invalid. Names that no other node
+			/// has are dropped from the tree data's string pool.</remarks>
+			void remove_children(const size_t& node);
+
+			/// <summary>Sort the children of a node.</summary>
+			/// <param name="node">The handle of the node, or <see cref="none"></see> for the top
+			/// level nodes.</param>
+			/// <param name="less">The comparison, which is given the names of two children and
+			/// returns true if the first should come before the second.</param>
+			/// <remarks>The sort is stable. Handles are not changed.</remarks>
+			void sort(const size_t& node,
+				const std::function<bool(const std::string&, const std::string&)>& less);
+
+		private:
+			class impl;
+			std::shared_ptr<impl> _d;
+
+			impl& modify();
+
+#if defined(LECUI_EXPORTS)
+			/// <summary>Whether the children of a node were added in the expand event, so that
+			/// they can be removed when it is collapsed.</summary>
+			bool loaded(const size_t& node) const;
+			tree_data& loaded(const size_t& node, const bool& loaded);
+
+			friend class widgets::tree_view_impl;
+#endif
+		};
+
 		/// <summary>Time class.</summary>
 		class lecui_api time {
 		public:
@@ -932,8 +1271,10 @@ namespace liblec {
 		class lecui_api get {
 		public:
 			/// <summary>Extract integer value.</summary>
-			/// <param name="value">The std::any containing the value.</param>
-			/// <returns>The integer.</returns>
+			/// <param name="value">The std::any containing the value, either an int or a long long.
+			/// </param>
+			/// <returns>The integer. A long long is truncated, so use std::any_cast for the full
+			/// range.</returns>
 			static int integer(const std::any& value);
 
 			/// <summary>Extract double value.</summary>
@@ -45,7 +45,7 @@ namespace liblec {
 
 			// parse the default item text
 			// the default color doesn't matter here we're just getting the plain text
-			std::vector<formatted_text_parser::text_range_properties> formatting;
+			std::shared_ptr<const formatted_text_parser::formatted_text_properties> formatting;
 			widgets::parse_formatted_text(default_item, _d._fm._d._tray_item_default,
 				D2D1::ColorF(D2D1::ColorF::Black), formatting);
 
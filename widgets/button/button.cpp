@@ -61,59 +61,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::button::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::button::cursor() { _generation++; return _cursor; }
 
 		widgets::button& widgets::button::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::button::font() { return _font; }
+		std::string& widgets::button::font() { _generation++; return _font; }
 
 		widgets::button& widgets::button::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::button::font_size() { return _font_size; }
+		float& widgets::button::font_size() { _generation++; return _font_size; }
 
 		widgets::button& widgets::button::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::button::color_text() { return _color_text; }
+		color& widgets::button::color_text() { _generation++; return _color_text; }
 
 		widgets::button& widgets::button::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::button::color_fill() { return _color_fill; }
+		color& widgets::button::color_fill() { _generation++; return _color_fill; }
 
 		widgets::button& widgets::button::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::button::color_hot() { return _color_hot; }
+		color& widgets::button::color_hot() { _generation++; return _color_hot; }
 
 		widgets::button& widgets::button::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::button::color_selected() { return _color_selected; }
+		color& widgets::button::color_selected() { _generation++; return _color_selected; }
 
 		widgets::button& widgets::button::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::button::color_disabled() { return _color_disabled; }
+		color& widgets::button::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::button& widgets::button::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -124,10 +132,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::button::color_border() { return _color_border; }
+		lecui::color& widgets::button::color_border() { _generation++; return _color_border; }
 
 		widgets::button& widgets::button::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -234,26 +243,12 @@ namespace liblec {
 
 		widgets::button&
 			widgets::button_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_button_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_button_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_button_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
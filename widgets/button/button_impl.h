@@ -49,7 +49,7 @@ namespace liblec {
 				button_impl& operator=(const button_impl&) = delete;
 
 				/// Private variables
-				widgets::button _specs, _specs_old;
+				widgets::button _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_border;
 				ID2D1SolidColorBrush* _p_brush_fill;
@@ -55,59 +55,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::checkbox::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::checkbox::cursor() { _generation++; return _cursor; }
 
 		widgets::checkbox& widgets::checkbox::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::checkbox::font() { return _font; }
+		std::string& widgets::checkbox::font() { _generation++; return _font; }
 
 		widgets::checkbox& widgets::checkbox::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::checkbox::font_size() { return _font_size; }
+		float& widgets::checkbox::font_size() { _generation++; return _font_size; }
 
 		widgets::checkbox& widgets::checkbox::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::checkbox::color_text() { return _color_text; }
+		color& widgets::checkbox::color_text() { _generation++; return _color_text; }
 
 		widgets::checkbox& widgets::checkbox::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::checkbox::color_fill() { return _color_fill; }
+		color& widgets::checkbox::color_fill() { _generation++; return _color_fill; }
 
 		widgets::checkbox& widgets::checkbox::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::checkbox::color_hot() { return _color_hot; }
+		color& widgets::checkbox::color_hot() { _generation++; return _color_hot; }
 
 		widgets::checkbox& widgets::checkbox::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::checkbox::color_selected() { return _color_selected; }
+		color& widgets::checkbox::color_selected() { _generation++; return _color_selected; }
 
 		widgets::checkbox& widgets::checkbox::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::checkbox::color_disabled() { return _color_disabled; }
+		color& widgets::checkbox::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::checkbox& widgets::checkbox::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -118,10 +126,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::checkbox::color_border() { return _color_border; }
+		lecui::color& widgets::checkbox::color_border() { _generation++; return _color_border; }
 
 		widgets::checkbox& widgets::checkbox::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -139,10 +148,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::checkbox::color_check() { return _color_check; }
+		lecui::color& widgets::checkbox::color_check() { _generation++; return _color_check; }
 
 		widgets::checkbox& widgets::checkbox::color_check(const color& color_check) {
 			_color_check = color_check;
+			_generation++;
 			return *this;
 		}
 
@@ -238,26 +248,12 @@ namespace liblec {
 
 		widgets::checkbox&
 			widgets::checkbox_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_checkbox_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_checkbox_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_checkbox_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -38,7 +38,6 @@ namespace liblec {
 
 		HRESULT widgets::checkbox_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = (_specs.events().check == nullptr && _specs.events().click == nullptr && _specs.events().action == nullptr);
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -103,12 +102,14 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::checkbox_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -278,6 +279,8 @@ namespace liblec {
 				_specs.events().right_click();
 		}
 
+		bool widgets::checkbox_impl::bounds_from_specs() { return false; }
+
 		widgets::checkbox&
 			widgets::checkbox_impl::specs() { return _specs; }
 
@@ -51,8 +51,11 @@ namespace liblec {
 				checkbox_impl(const checkbox_impl&) = delete;
 				checkbox_impl& operator=(const checkbox_impl&) = delete;
 
+				/// The rect depends on the text and status, which are set without touching the generation.
+				bool bounds_from_specs() override;
+
 				/// Private variables
-				widgets::checkbox _specs, _specs_old;
+				widgets::checkbox _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_check;
 				ID2D1SolidColorBrush* _p_brush_border;
@@ -61,59 +61,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::combobox::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::combobox::cursor() { _generation++; return _cursor; }
 
 		widgets::combobox& widgets::combobox::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::combobox::font() { return _font; }
+		std::string& widgets::combobox::font() { _generation++; return _font; }
 
 		widgets::combobox& widgets::combobox::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::combobox::font_size() { return _font_size; }
+		float& widgets::combobox::font_size() { _generation++; return _font_size; }
 
 		widgets::combobox& widgets::combobox::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::combobox::color_text() { return _color_text; }
+		color& widgets::combobox::color_text() { _generation++; return _color_text; }
 
 		widgets::combobox& widgets::combobox::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::combobox::color_fill() { return _color_fill; }
+		color& widgets::combobox::color_fill() { _generation++; return _color_fill; }
 
 		widgets::combobox& widgets::combobox::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::combobox::color_hot() { return _color_hot; }
+		color& widgets::combobox::color_hot() { _generation++; return _color_hot; }
 
 		widgets::combobox& widgets::combobox::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::combobox::color_selected() { return _color_selected; }
+		color& widgets::combobox::color_selected() { _generation++; return _color_selected; }
 
 		widgets::combobox& widgets::combobox::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::combobox::color_disabled() { return _color_disabled; }
+		color& widgets::combobox::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::combobox& widgets::combobox::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -124,10 +132,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_border() { return _color_border; }
+		lecui::color& widgets::combobox::color_border() { _generation++; return _color_border; }
 
 		widgets::combobox& widgets::combobox::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -145,52 +154,59 @@ namespace liblec {
 			return *this;
 		}
 
-		bool& widgets::combobox::editable() { return _editable; }
+		bool& widgets::combobox::editable() { _generation++; return _editable; }
 
 		widgets::combobox& widgets::combobox::editable(const bool& editable) {
 			_editable = editable;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_fill_editable() { return _color_fill_editable; }
+		lecui::color& widgets::combobox::color_fill_editable() { _generation++; return _color_fill_editable; }
 
 		widgets::combobox& widgets::combobox::color_fill_editable(const color& color_fill_editable) {
 			_color_fill_editable = color_fill_editable;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_caret() { return _color_caret; }
+		lecui::color& widgets::combobox::color_caret() { _generation++; return _color_caret; }
 
 		widgets::combobox& widgets::combobox::color_caret(const color& color_caret) {
 			_color_caret = color_caret;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_dropdown() { return _color_dropdown; }
+		lecui::color& widgets::combobox::color_dropdown() { _generation++; return _color_dropdown; }
 
 		widgets::combobox& widgets::combobox::color_dropdown(const color& color_dropdown) {
 			_color_dropdown = color_dropdown;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_dropdown_hot() { return _color_dropdown_hot; }
+		lecui::color& widgets::combobox::color_dropdown_hot() { _generation++; return _color_dropdown_hot; }
 
 		widgets::combobox& widgets::combobox::color_dropdown_hot(const color& color_dropdown_hot) {
 			_color_dropdown_hot = color_dropdown_hot;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_dropdown_arrow() { return _color_dropdown_arrow; }
+		lecui::color& widgets::combobox::color_dropdown_arrow() { _generation++; return _color_dropdown_arrow; }
 
 		widgets::combobox& widgets::combobox::color_dropdown_arrow(const color& color_dropdown_arrow) {
 			_color_dropdown_arrow = color_dropdown_arrow;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::combobox::color_dropdown_arrow_hot() { return _color_dropdown_arrow_hot; }
+		lecui::color& widgets::combobox::color_dropdown_arrow_hot() { _generation++; return _color_dropdown_arrow_hot; }
 
 		widgets::combobox& widgets::combobox::color_dropdown_arrow_hot(const color& color_dropdown_arrow_hot) {
 			_color_dropdown_arrow_hot = color_dropdown_arrow_hot;
+			_generation++;
 			return *this;
 		}
 
@@ -317,26 +333,12 @@ namespace liblec {
 
 		widgets::combobox&
 			widgets::combobox_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_combobox_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_combobox_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_combobox_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -60,7 +60,7 @@ namespace liblec {
 				combobox_impl& operator=(const combobox_impl&) = delete;
 
 				/// Private variables
-				widgets::combobox _specs, _specs_old;
+				widgets::combobox _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_caret;
 				ID2D1SolidColorBrush* _p_brush_fill;
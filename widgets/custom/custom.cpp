@@ -61,59 +61,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::custom::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::custom::cursor() { _generation++; return _cursor; }
 
 		widgets::custom& widgets::custom::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::custom::font() { return _font; }
+		std::string& widgets::custom::font() { _generation++; return _font; }
 
 		widgets::custom& widgets::custom::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::custom::font_size() { return _font_size; }
+		float& widgets::custom::font_size() { _generation++; return _font_size; }
 
 		widgets::custom& widgets::custom::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::custom::color_text() { return _color_text; }
+		color& widgets::custom::color_text() { _generation++; return _color_text; }
 
 		widgets::custom& widgets::custom::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::custom::color_fill() { return _color_fill; }
+		color& widgets::custom::color_fill() { _generation++; return _color_fill; }
 
 		widgets::custom& widgets::custom::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::custom::color_hot() { return _color_hot; }
+		color& widgets::custom::color_hot() { _generation++; return _color_hot; }
 
 		widgets::custom& widgets::custom::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::custom::color_selected() { return _color_selected; }
+		color& widgets::custom::color_selected() { _generation++; return _color_selected; }
 
 		widgets::custom& widgets::custom::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::custom::color_disabled() { return _color_disabled; }
+		color& widgets::custom::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::custom& widgets::custom::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -194,26 +202,12 @@ namespace liblec {
 
 		widgets::custom&
 			widgets::custom_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_custom_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_custom_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_custom_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
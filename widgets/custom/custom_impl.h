@@ -49,7 +49,7 @@ namespace liblec {
 				custom_impl& operator=(const custom_impl&) = delete;
 
 				/// Private variables
-				widgets::custom _specs, _specs_old;
+				widgets::custom _specs;
 
 				IDWriteFactory* _p_directwrite_factory;
 				IWICImagingFactory* _p_iwic_factory;
@@ -62,7 +62,6 @@ namespace liblec {
 
 		HRESULT widgets::date_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = (_specs.events().click == nullptr && _specs.events().action == nullptr);
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -96,9 +95,8 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::date_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 
 				try {
 					// update label widget
@@ -144,6 +142,9 @@ namespace liblec {
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
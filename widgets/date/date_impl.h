@@ -68,7 +68,7 @@ namespace liblec {
 				date_impl& operator=(const date_impl&) = delete;
 
 				/// Private variables
-				widgets::date _specs, _specs_old;
+				widgets::date _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
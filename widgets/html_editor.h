@@ -37,6 +37,7 @@ namespace liblec {
 
 				void* _p_controls_pane_specs = nullptr;
 				void* _p_html_pane_specs = nullptr;
+				void* _p_document = nullptr;
 				lecui::rect _rect_widget_overall = { 0, 0, 0, 0 };
 				resize_params _on_resize_overall = { 0.f, 0.f, 0.f, 0.f };
 
@@ -59,6 +60,17 @@ namespace liblec {
 				/// <returns>Returns true if the specs are NOT equal, else false.</returns>
 				bool operator!=(const html_editor& param);
 
+				/// <summary>Copy html editor specs. Only essential properties are copied.</summary>
+				/// <param name="param">The html editor specs to copy.</param>
+				/// <returns>Returns a reference to the copy.</returns>
+				/// <remarks>The copy is not attached to the widget the specs were taken from, so
+				/// editing the widget afterwards does not change the copy's text.</remarks>
+				html_editor& operator=(const html_editor& param);
+
+				/// <summary>Copy constructor.</summary>
+				/// <param name="param">The html editor specs to copy.</param>
+				html_editor(const html_editor& param);
+
 				// generic widget
 
 				/// <summary>Get or set the widget text.</summary>
@@ -11,6 +11,7 @@
 #include "../html_editor.h"
 #include "../html_view.h"
 #include "../../form_impl/form_impl.h"
+#include "../../formatted_text_editor/formatted_text_document.h"
 
 namespace liblec {
 	namespace lecui {
@@ -30,10 +31,54 @@ namespace liblec {
 			return !operator==(param);
 		}
 
-		std::string& widgets::html_editor::text() { return _text; }
+		widgets::html_editor& widgets::html_editor::operator=(const html_editor& right) {
+			// generic widget
+			widget::operator=(right);
+
+			if (right._p_document)	// the document is edited in place ... take its current text
+				_text = reinterpret_cast<formatted_text_document*>(right._p_document)->xml();
+
+			// widget specific widget
+			_border = right._border;
+			_control_border = right._control_border;
+			_color_border = right._color_border;
+			_corner_radius_x = right._corner_radius_x;
+			_corner_radius_y = right._corner_radius_y;
+			_color_caret = right._color_caret;
+			_color_control_border = right._color_control_border;
+			_color_control_fill = right._color_control_fill;
+			_alignment = right._alignment;
+			_p_controls_pane_specs = right._p_controls_pane_specs;
+			_p_html_pane_specs = right._p_html_pane_specs;
+			_rect_widget_overall = right._rect_widget_overall;
+			_on_resize_overall = right._on_resize_overall;
+			_view_only = right._view_only;
+
+			// NOT copied (_p_document)
+
+			if (_p_document)	// the text has been replaced, the document is to pick it up
+				reinterpret_cast<formatted_text_document*>(_p_document)->check_out();
+
+			return *this;
+		}
+
+		widgets::html_editor::html_editor(const html_editor& right) {
+			*this = right;
+		}
+
+		std::string& widgets::html_editor::text() {
+			if (_p_document)	// the document is edited in place ... bring the text up to date
+				reinterpret_cast<formatted_text_document*>(_p_document)->check_out(_text);
+
+			return _text;
+		}
 
 		widgets::html_editor& widgets::html_editor::text(const std::string& text) {
 			_text = text;
+
+			if (_p_document)
+				reinterpret_cast<formatted_text_document*>(_p_document)->check_out();
+
 			return *this;
 		}
 
@@ -76,59 +121,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::html_editor::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::html_editor::cursor() { _generation++; return _cursor; }
 
 		widgets::html_editor& widgets::html_editor::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::html_editor::font() { return _font; }
+		std::string& widgets::html_editor::font() { _generation++; return _font; }
 
 		widgets::html_editor& widgets::html_editor::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::html_editor::font_size() { return _font_size; }
+		float& widgets::html_editor::font_size() { _generation++; return _font_size; }
 
 		widgets::html_editor& widgets::html_editor::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::html_editor::color_text() { return _color_text; }
+		color& widgets::html_editor::color_text() { _generation++; return _color_text; }
 
 		widgets::html_editor& widgets::html_editor::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::html_editor::color_fill() { return _color_fill; }
+		color& widgets::html_editor::color_fill() { _generation++; return _color_fill; }
 
 		widgets::html_editor& widgets::html_editor::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::html_editor::color_hot() { return _color_hot; }
+		color& widgets::html_editor::color_hot() { _generation++; return _color_hot; }
 
 		widgets::html_editor& widgets::html_editor::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::html_editor::color_selected() { return _color_selected; }
+		color& widgets::html_editor::color_selected() { _generation++; return _color_selected; }
 
 		widgets::html_editor& widgets::html_editor::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::html_editor::color_disabled() { return _color_disabled; }
+		color& widgets::html_editor::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::html_editor& widgets::html_editor::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -165,6 +218,8 @@ namespace liblec {
 		}
 
 		lecui::color& widgets::html_editor::color_border() {
+			_generation++;
+
 			if (_p_controls_pane_specs && _p_html_pane_specs)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane_specs*>(_p_html_pane_specs)->color_border();
 			else
@@ -177,6 +232,7 @@ namespace liblec {
 			else
 				_color_border = color_border;
 
+			_generation++;
 			return *this;
 		}
 
@@ -194,14 +250,17 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::html_editor::color_caret() { return _color_caret; }
+		lecui::color& widgets::html_editor::color_caret() { _generation++; return _color_caret; }
 
 		widgets::html_editor& widgets::html_editor::color_caret(const color& color_caret) {
 			_color_caret = color_caret;
+			_generation++;
 			return *this;
 		}
 
 		lecui::color& widgets::html_editor::color_control_border() {
+			_generation++;
+
 			if (_p_controls_pane_specs && _p_html_pane_specs)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane_specs*>(_p_controls_pane_specs)->color_border();
 			else
@@ -214,10 +273,13 @@ namespace liblec {
 			else
 				_color_control_border = color_control_border;
 
+			_generation++;
 			return *this;
 		}
 
 		lecui::color& widgets::html_editor::color_control_fill() {
+			_generation++;
+
 			if (_p_controls_pane_specs && _p_html_pane_specs)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane_specs*>(_p_controls_pane_specs)->color_fill();
 			else
@@ -230,6 +292,7 @@ namespace liblec {
 			else
 				_color_control_fill = color_control_fill;
 
+			_generation++;
 			return *this;
 		}
 
@@ -329,26 +392,12 @@ namespace liblec {
 
 		widgets::html_editor&
 			widgets::html_editor_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_html_editor_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_html_editor_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_html_editor_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
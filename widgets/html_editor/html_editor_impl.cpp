@@ -11,7 +11,6 @@
 #include "html_editor_impl.h"
 #include "../../utilities/timer.h"
 #include "../label/label_impl.h"
-#include "../../formatted_text_editor/formatted_text_editor.h"
 #include "../../form_impl/form_impl.h"
 #include "../../containers/page/page_impl.h"
 #include <memory>
@@ -98,7 +97,6 @@ namespace liblec {
 
 		HRESULT widgets::html_editor_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = false;
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -176,9 +174,8 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::html_editor_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 
 				try {
 					if (_html_pane_specs.has_value()) {
@@ -201,6 +198,9 @@ namespace liblec {
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -214,36 +214,33 @@ namespace liblec {
 			if (!render || !_visible)
 				return _rect;
 
+			// pick up any changes made to the text through the specs
+			sync_document();
+
 			// make sure caret is well positioned in case text has since been changed
-			_caret_position = smallest(_caret_position, static_cast<UINT32>(_specs.text().length()));
+			_caret_position = smallest(_caret_position, static_cast<UINT32>(_document.length()));
 
 			D2D1_ROUNDED_RECT rounded_rect{ _rect,
 				_specs.corner_radius_x(), _specs.corner_radius_y() };
 
 			// create a text layout
-			std::string _text = _specs.text();
-
 			auto _rect_text = _rect;
 
 			// measure the text
 			D2D1_RECT_F rect_optimal = _rect_text;
 
-			// get formatting
+			// the document keeps the plaintext and the formatting up to date as it is edited
+			const auto& _plain_text = _document.plain_text();
 
-			// to-do: performance issues ... only redo if there's been a change
-			if (true) {
-				parse_formatted_text(_specs.text(), _text, convert_color(_specs.color_text()), _formatting);
-			}
-
-			HRESULT hr = _p_directwrite_factory->CreateTextLayout(convert_string(_text).c_str(),
-				(UINT32)_text.length(), _p_text_format, _rect_text.right - _rect_text.left,
+			HRESULT hr = _p_directwrite_factory->CreateTextLayout(convert_string(_plain_text).c_str(),
+				(UINT32)_plain_text.length(), _p_text_format, _rect_text.right - _rect_text.left,
 				_rect_text.bottom - _rect_text.top, &_p_text_layout);
 
 			DWRITE_TEXT_METRICS textMetrics;
 
 			if (SUCCEEDED(hr)) {
 				// apply formatting
-				apply_formatting(_formatting, p_render_target, _p_text_layout, _is_enabled,
+				apply_formatting(_document.formatting(convert_color(_specs.color_text())), p_render_target, _p_text_layout, _is_enabled,
 					_p_brush_disabled);
 
 				_p_text_layout->GetMetrics(&textMetrics);
@@ -270,7 +267,7 @@ namespace liblec {
 				if (_key_up_scheduled || _key_down_scheduled) {
 					// get selection rects of entire text area
 					const UINT32 start = 0;
-					const UINT32 end = static_cast<UINT32>(_text.length());
+					const UINT32 end = static_cast<UINT32>(_plain_text.length());
 
 					auto full_text_selection_rects = get_selection_rects(_p_text_layout,
 						_rect_text, start, end);
@@ -287,11 +284,11 @@ namespace liblec {
 					else {
 						selection_info sel_info;
 
-						end_special_case = _caret_position == _text.length();
+						end_special_case = _caret_position == _plain_text.length();
 						
 						if (_key_up_scheduled) {
 							auto pos = _caret_position;
-							if (pos == _text.length())
+							if (pos == _plain_text.length())
 								pos--;
 							sel_info.start = pos;
 							sel_info.end = sel_info.start + 1;
@@ -322,7 +319,7 @@ namespace liblec {
 
 						// find corresponding point within this line for caret
 						D2D1_POINT_2F pt = { (end_special_case ? selection_rects[0].right : selection_rects[0].left) * get_dpi_scale(), (rect_above.top + ((rect_above.bottom - rect_above.top) / 2.f)) * get_dpi_scale() };
-						_caret_position = get_caret_position(_p_text_layout, _text, _rect_text,
+						_caret_position = get_caret_position(_p_text_layout, _plain_text, _rect_text,
 							pt, get_dpi_scale());
 
 						reset_selection();
@@ -340,7 +337,7 @@ namespace liblec {
 
 						// find corresponding point within this line for caret
 						D2D1_POINT_2F pt = { selection_rects[selection_rects.size() - 1].right * get_dpi_scale(), (rect_below.top + ((rect_below.bottom - rect_below.top) / 2.f)) * get_dpi_scale() };
-						_caret_position = get_caret_position(_p_text_layout, _text, _rect_text,
+						_caret_position = get_caret_position(_p_text_layout, _plain_text, _rect_text,
 							pt, get_dpi_scale());
 
 						reset_selection();
@@ -353,14 +350,14 @@ namespace liblec {
 					if (_hit && _pressed) {
 						reset_selection();
 
-						_caret_position = get_caret_position(_p_text_layout, _specs.text(), _rect_text, _point, get_dpi_scale());
+						_caret_position = get_caret_position(_p_text_layout, _document.plain_text(), _rect_text, _point, get_dpi_scale());
 						_caret_visible = true;
 
 						if (_point.x != _point_on_press.x || _point.y != _point_on_press.y) {
 							// user is making a selection
 							_is_selecting = true;
 
-							auto _selection_start = get_caret_position(_p_text_layout, _specs.text(), _rect_text, _point_on_press, get_dpi_scale());
+							auto _selection_start = get_caret_position(_p_text_layout, _document.plain_text(), _rect_text, _point_on_press, get_dpi_scale());
 							auto _selection_end = _caret_position;
 
 							auto selection_rects = get_selection_rects(_p_text_layout, _rect_text, _selection_start, _selection_end);
@@ -374,8 +371,8 @@ namespace liblec {
 							_is_selecting = false;
 
 							set_selection(
-								get_caret_position(_p_text_layout, _specs.text(), _rect_text, _point_on_press, get_dpi_scale()),
-								get_caret_position(_p_text_layout, _specs.text(), _rect_text, _point_on_release, get_dpi_scale()));
+								get_caret_position(_p_text_layout, _document.plain_text(), _rect_text, _point_on_press, get_dpi_scale()),
+								get_caret_position(_p_text_layout, _document.plain_text(), _rect_text, _point_on_release, get_dpi_scale()));
 						}
 				}
 			}
@@ -460,7 +457,7 @@ namespace liblec {
 							_skip_blink = false;
 						else {
 							_caret_visible = !_caret_visible;
-							get_form().update();
+							invalidate();
 						}
 					});
 			}
@@ -486,17 +483,19 @@ namespace liblec {
 		void widgets::html_editor_impl::insert_character(const char& c) {
 			if (!_specs._view_only) {
 				try {
+					sync_document();
+
 					unsigned long tag_number = 0;
 					if (_is_selected) {
 						if (_selection_info.start > _selection_info.end)
 							swap(_selection_info.start, _selection_info.end);
 
 						_caret_position = _selection_info.start;
-						tag_number = formatted_text_editor().erase(_selection_info.start, _selection_info.end, _specs.text());
+						tag_number = _document.erase(_selection_info.start, _selection_info.end);
 						reset_selection();
 					}
 
-					formatted_text_editor().insert_character(c, _caret_position, tag_number, _specs.text());
+					_document.insert_character(c, _caret_position, tag_number);
 					_caret_position++;
 					_caret_visible = true;
 					_skip_blink = true;
@@ -512,17 +511,19 @@ namespace liblec {
 		void widgets::html_editor_impl::key_backspace() {
 			if (!_specs._view_only) {
 				try {
+					sync_document();
+
 					unsigned long tag_number = 0;
 					if (_is_selected) {
 						if (_selection_info.start > _selection_info.end)
 							swap(_selection_info.start, _selection_info.end);
 
 						_caret_position = _selection_info.start;
-						tag_number = formatted_text_editor().erase(_selection_info.start, _selection_info.end, _specs.text());
+						tag_number = _document.erase(_selection_info.start, _selection_info.end);
 						reset_selection();
 					}
 					else {
-						tag_number = formatted_text_editor().erase(_caret_position - 1, _caret_position, _specs.text());
+						tag_number = _document.erase(_caret_position - 1, _caret_position);
 						_caret_position--;
 						_caret_visible = true;
 						_skip_blink = true;
@@ -536,17 +537,19 @@ namespace liblec {
 		void widgets::html_editor_impl::key_delete() {
 			if (!_specs._view_only) {
 				try {
+					sync_document();
+
 					unsigned long tag_number = 0;
 					if (_is_selected) {
 						if (_selection_info.start > _selection_info.end)
 							swap(_selection_info.start, _selection_info.end);
 
 						_caret_position = _selection_info.start;
-						tag_number = formatted_text_editor().erase(_selection_info.start, _selection_info.end, _specs.text());
+						tag_number = _document.erase(_selection_info.start, _selection_info.end);
 						reset_selection();
 					}
 					else {
-						tag_number = formatted_text_editor().erase(_caret_position, _caret_position + 1, _specs.text());
+						tag_number = _document.erase(_caret_position, _caret_position + 1);
 						_caret_visible = true;
 						_skip_blink = true;
 					}
@@ -584,7 +587,7 @@ namespace liblec {
 					reset_selection();
 				}
 
-				if (_caret_position < _specs.text().length())
+				if (_caret_position < _document.length())
 					_caret_position++;
 
 				_caret_visible = true;
@@ -608,8 +611,10 @@ namespace liblec {
 		}
 
 		void widgets::html_editor_impl::select_all() {
+			sync_document();
+
 			// move caret to the end
-			_caret_position = static_cast<UINT32>(_specs.text().length());
+			_caret_position = static_cast<UINT32>(_document.length());
 
 			// select all text
 			set_selection(0, _caret_position);
@@ -617,46 +622,51 @@ namespace liblec {
 
 		void widgets::html_editor_impl::selection_font(const std::string& font_name) {
 			log("selection_font: " + font_name);
+			sync_document();
 			std::vector<xml_parser::tag_attribute> tag_attributes;
 			xml_parser::tag_attribute tag_attribute;
 			tag_attribute.name = "style";
 			tag_attribute.value = "font-family: " + font_name + ";";
 			tag_attributes.push_back(tag_attribute);
-			formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+			_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 		}
 
 		void widgets::html_editor_impl::selection_font_size(const float& font_size) {
 			log("selection_font_size: " + std::to_string(font_size));
+			sync_document();
 			std::vector<xml_parser::tag_attribute> tag_attributes;
 			xml_parser::tag_attribute tag_attribute;
 			tag_attribute.name = "style";
 			tag_attribute.value = "font-size: " + std::to_string(font_size) + "pt;";
 			tag_attributes.push_back(tag_attribute);
-			formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+			_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 		}
 
 		void widgets::html_editor_impl::selection_bold() {
 			log("selection_bold");
+			sync_document();
 			std::vector<xml_parser::tag_attribute> tag_attributes;
 			xml_parser::tag_attribute tag_attribute;
 			tag_attribute.name = "style";
 			tag_attribute.value = "font-weight: bold;";
 			tag_attributes.push_back(tag_attribute);
-			formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+			_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 		}
 
 		void widgets::html_editor_impl::selection_italic() {
 			log("selection_italic");
+			sync_document();
 			std::vector<xml_parser::tag_attribute> tag_attributes;
 			xml_parser::tag_attribute tag_attribute;
 			tag_attribute.name = "style";
 			tag_attribute.value = "font-style: italic;";
 			tag_attributes.push_back(tag_attribute);
-			formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+			_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 		}
 
 		void widgets::html_editor_impl::selection_underline() {
 			log("selection_underline");
+			sync_document();
 			if (false) {
 				// to-do: make it possible for this to work together with text-decoration: line-through
 				std::vector<xml_parser::tag_attribute> tag_attributes;
@@ -664,20 +674,21 @@ namespace liblec {
 				tag_attribute.name = "style";
 				tag_attribute.value = "text-decoration: underline;";
 				tag_attributes.push_back(tag_attribute);
-				formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+				_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 			}
 			else
-				formatted_text_editor().toggle_tag(_specs.text(), "u", _selection_info.start, _selection_info.end);
+				_document.toggle_tag("u", _selection_info.start, _selection_info.end);
 		}
 
 		void widgets::html_editor_impl::selection_strikethrough() {
 			log("selection_strikethrough");
+			sync_document();
 			std::vector<xml_parser::tag_attribute> tag_attributes;
 			xml_parser::tag_attribute tag_attribute;
 			tag_attribute.name = "style";
 			tag_attribute.value = "text-decoration: line-through;";
 			tag_attributes.push_back(tag_attribute);
-			formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+			_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 		}
 
 		void widgets::html_editor_impl::selection_color() {
@@ -686,6 +697,7 @@ namespace liblec {
 
 		void widgets::html_editor_impl::selection_color(const color& font_color) {
 			_last_color = font_color;
+			sync_document();
 
 			std::string color_string = "rgb(" +
 				std::to_string(font_color.get_red()) + ", "
@@ -697,13 +709,20 @@ namespace liblec {
 			tag_attribute.name = "style";
 			tag_attribute.value = "color: " + color_string + ";";
 			tag_attributes.push_back(tag_attribute);
-			formatted_text_editor().toggle_tag(_specs.text(), "span", tag_attributes, _selection_info.start, _selection_info.end);
+			_document.toggle_tag("span", tag_attributes, _selection_info.start, _selection_info.end);
 		}
 
 		color widgets::html_editor_impl::get_last_color() {
 			return _last_color;
 		}
 
+		void widgets::html_editor_impl::sync_document() {
+			// let the specs know where the document is so the text can be brought up to date
+			// when it is asked for, see html_editor::text()
+			_specs._p_document = &_document;
+			_document.sync(_specs._text);
+		}
+
 		void widgets::html_editor_impl::reset_selection() {
 			_selection_info = { 0, 0 };
 			_is_selected = false;
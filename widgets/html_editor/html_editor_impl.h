@@ -14,6 +14,7 @@
 #include "../widget_impl.h"
 #include "../html_editor.h"
 #include "../../formatted_text_parser/formatted_text_parser.h"
+#include "../../formatted_text_editor/formatted_text_document.h"
 #include "../../containers/page.h"
 #include "../../containers/page/page_impl.h"
 #include "../../containers/pane/pane_impl.h"
@@ -90,7 +91,7 @@ namespace liblec {
 
 				/// Private variables
 				bool _controls_initialized;
-				widgets::html_editor _specs, _specs_old;
+				widgets::html_editor _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_caret;
 				ID2D1SolidColorBrush* _p_brush_border;
@@ -125,7 +126,8 @@ namespace liblec {
 
 				float _scroll_amount;
 
-				std::vector<formatted_text_parser::text_range_properties> _formatting;
+				/// the document being edited, which also keeps its plaintext and formatting
+				formatted_text_document _document;
 
 				std::optional<std::reference_wrapper<containers::pane_specs>>
 					_html_control_pane_specs,
@@ -133,6 +135,7 @@ namespace liblec {
 
 				/// Private methods.
 				void reset_selection();
+				void sync_document();
 				void set_selection(const UINT start, const UINT end);
 
 				static UINT32 count_characters(IDWriteTextLayout* p_text_layout,
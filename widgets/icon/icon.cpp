@@ -82,59 +82,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::icon::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::icon::cursor() { _generation++; return _cursor; }
 
 		widgets::icon& widgets::icon::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::icon::font() { return _font; }
+		std::string& widgets::icon::font() { _generation++; return _font; }
 
 		widgets::icon& widgets::icon::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::icon::font_size() { return _font_size; }
+		float& widgets::icon::font_size() { _generation++; return _font_size; }
 
 		widgets::icon& widgets::icon::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::icon::color_text() { return _color_text; }
+		color& widgets::icon::color_text() { _generation++; return _color_text; }
 
 		widgets::icon& widgets::icon::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::icon::color_fill() { return _color_fill; }
+		color& widgets::icon::color_fill() { _generation++; return _color_fill; }
 
 		widgets::icon& widgets::icon::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::icon::color_hot() { return _color_hot; }
+		color& widgets::icon::color_hot() { _generation++; return _color_hot; }
 
 		widgets::icon& widgets::icon::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::icon::color_selected() { return _color_selected; }
+		color& widgets::icon::color_selected() { _generation++; return _color_selected; }
 
 		widgets::icon& widgets::icon::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::icon::color_disabled() { return _color_disabled; }
+		color& widgets::icon::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::icon& widgets::icon::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -145,10 +153,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::icon::color_border() { return _color_border; }
+		lecui::color& widgets::icon::color_border() { _generation++; return _color_border; }
 
 		widgets::icon& widgets::icon::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -173,10 +182,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::icon::color_text_description() { return _color_text_description; }
+		lecui::color& widgets::icon::color_text_description() { _generation++; return _color_text_description; }
 
 		widgets::icon& widgets::icon::color_text_description(const color& color_text_description) {
 			_color_text_description = color_text_description;
+			_generation++;
 			return *this;
 		}
 
@@ -187,17 +197,19 @@ namespace liblec {
 			return *this;
 		}
 
-		int& widgets::icon::png_resource() { return _png_resource; }
+		int& widgets::icon::png_resource() { _generation++; return _png_resource; }
 
 		widgets::icon& widgets::icon::png_resource(const int& png_resource) {
 			_png_resource = png_resource;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::icon::file() { return _file; }
+		std::string& widgets::icon::file() { _generation++; return _file; }
 
 		widgets::icon& widgets::icon::file(const std::string& file) {
 			_file = file;
+			_generation++;
 			return *this;
 		}
 
@@ -342,26 +354,12 @@ namespace liblec {
 		widgets::icon&
 			widgets::icon_builder::specs(form& fm,
 				const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_icon_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_icon_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_icon_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -49,7 +49,6 @@ namespace liblec {
 
 		HRESULT widgets::icon_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = (_specs.events().click == nullptr && _specs.events().action == nullptr);
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -89,9 +88,8 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::icon_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 
 				try {
 					if (_rectangle_specs.has_value()) {
@@ -138,6 +136,9 @@ namespace liblec {
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -60,7 +60,7 @@ namespace liblec {
 				icon_impl& operator=(const icon_impl&) = delete;
 
 				/// Private variables
-				widgets::icon _specs, _specs_old;
+				widgets::icon _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
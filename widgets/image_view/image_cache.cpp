@@ -0,0 +1,553 @@
+//
+// image_cache.cpp - image cache implementation
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#include "image_cache.h"
+
+#include <cmath>
+
+#define IMAGECACHE	0	// set to 1 to log the cache's hits, misses and size whenever a bitmap is made, 0 otherwise
+
+namespace liblec {
+	namespace lecui {
+		constexpr size_t image_cache_budget = 64 * 1024 * 1024;	// the memory the cache may take up, in bytes
+		constexpr float image_cache_size_step = 32.f;	// target sizes are rounded up to this, in pixels
+		constexpr unsigned image_cache_max_workers = 4;	// the most threads to decode images with
+
+		image_cache::~image_cache() {
+			shutdown();
+		}
+
+		HRESULT image_cache::load_bitmap_resource(const void* p_owner, ID2D1RenderTarget* p_render_target,
+			HINSTANCE h_inst, int id_image, const std::string& resource_type, ID2D1Bitmap** pp_bitmap,
+			size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality) {
+			const std::string source = "resource:" +
+				std::to_string(reinterpret_cast<uintptr_t>(h_inst)) + ":" +
+				resource_type + ":" + std::to_string(id_image);
+
+			// the resource's memory stays valid for as long as the module is loaded, so it is
+			// located here and only read by the worker
+			auto open = [h_inst, id_image, resource_type](IWICImagingFactory* p_IWICFactory,
+				IWICBitmapDecoder** pp_decoder) {
+				// Locate the resource.
+				HRSRC image_resource_handle = FindResourceA(h_inst, MAKEINTRESOURCEA(id_image), resource_type.c_str());
+				HGLOBAL image_resource_data_handle = NULL;
+				void* p_image_file = nullptr;
+				DWORD image_file_size = 0;
+
+				HRESULT hr = image_resource_handle ? S_OK : E_FAIL;
+				if (SUCCEEDED(hr)) {
+					// Load the resource.
+					image_resource_data_handle = LoadResource(h_inst, image_resource_handle);
+					hr = image_resource_data_handle ? S_OK : E_FAIL;
+				}
+
+				if (SUCCEEDED(hr)) {
+					// Lock it to get a system memory pointer.
+					p_image_file = LockResource(image_resource_data_handle);
+					hr = p_image_file ? S_OK : E_FAIL;
+				}
+
+				if (SUCCEEDED(hr)) {
+					// Calculate the size.
+					image_file_size = SizeofResource(h_inst, image_resource_handle);
+					hr = image_file_size ? S_OK : E_FAIL;
+				}
+
+				if (SUCCEEDED(hr))
+					hr = open_memory(p_IWICFactory, reinterpret_cast<const BYTE*>(p_image_file),
+						image_file_size, pp_decoder);
+
+				return hr;
+			};
+
+			return load_bitmap(p_owner, p_render_target, source, open, pp_bitmap,
+				target_size, enlarge_if_smaller, keep_aspect_ratio, quality);
+		}
+
+		HRESULT image_cache::load_bitmap_file(const void* p_owner, ID2D1RenderTarget* p_render_target,
+			const std::string& file, ID2D1Bitmap** pp_bitmap,
+			size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality) {
+			auto open = [file](IWICImagingFactory* p_IWICFactory, IWICBitmapDecoder** pp_decoder) {
+				return p_IWICFactory->CreateDecoderFromFilename(convert_string(file).c_str(), nullptr,
+					GENERIC_READ, WICDecodeMetadataCacheOnLoad, pp_decoder);
+			};
+
+			// the file's last write time is part of the key so that a file that has been changed
+			// is decoded again; the frames of the old file age out of the cache. The widget asks
+			// again on every render until the bitmap is ready, so the file is only looked at once
+			// for as long as its bitmaps are pending
+			std::string source;
+			const auto pending_source = _file_sources.find(file);
+
+			if (pending_source != _file_sources.end())
+				source = pending_source->second;
+			else {
+				source = "file:" + file;
+				WIN32_FILE_ATTRIBUTE_DATA attributes = {};
+
+				if (GetFileAttributesExW(convert_string(file).c_str(), GetFileExInfoStandard, &attributes)) {
+					ULARGE_INTEGER write_time = {};
+					write_time.LowPart = attributes.ftLastWriteTime.dwLowDateTime;
+					write_time.HighPart = attributes.ftLastWriteTime.dwHighDateTime;
+					source += ":" + std::to_string(write_time.QuadPart);
+				}
+			}
+
+			const HRESULT hr = load_bitmap(p_owner, p_render_target, source, open, pp_bitmap,
+				target_size, enlarge_if_smaller, keep_aspect_ratio, quality);
+
+			if (hr == E_PENDING)
+				_file_sources[file] = source;
+
+			return hr;
+		}
+
+		void image_cache::cancel(const void* p_owner) {
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			// only the queued requests can be withdrawn; those being worked on are left to finish
+			for (auto it = _queue.begin(); it != _queue.end();) {
+				(*it)->owners.erase(p_owner);
+
+				if ((*it)->owners.empty()) {
+					_jobs.erase((*it)->key);
+					forget_source((*it)->source);
+					it = _queue.erase(it);
+				}
+				else
+					it++;
+			}
+		}
+
+		bool image_cache::collect() {
+			std::vector<std::shared_ptr<job>> done;
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				done.swap(_done);
+			}
+
+			for (auto& p_job : done) {
+				_jobs.erase(p_job->key);
+				forget_source(p_job->source);
+
+				if (FAILED(p_job->hr)) {
+					// remembered so that a missing or corrupt image isn't decoded over and over
+					_failed[p_job->key] = p_job->hr;
+					continue;
+				}
+
+				if (p_job->frame_decoded && !find(p_job->source)) {
+					UINT width = 0, height = 0;
+					p_job->p_frame->GetSize(&width, &height);
+
+					auto& e = add(p_job->source);
+					e.p_frame = p_job->p_frame;
+					e.p_frame->AddRef();
+					e.bytes = static_cast<size_t>(width) * height * 4;
+					_bytes += e.bytes;
+				}
+
+				if (!find(p_job->key)) {
+					// made into a bitmap when the widget next asks for it
+					UINT width = 0, height = 0;
+					p_job->p_scaled->GetSize(&width, &height);
+
+					auto& e = add(p_job->key);
+					e.p_frame = p_job->p_scaled;
+					p_job->p_scaled = nullptr;
+					e.bytes = static_cast<size_t>(width) * height * 4;
+					_bytes += e.bytes;
+				}
+			}
+
+			trim();
+			return !done.empty();
+		}
+
+		bool image_cache::pending() const {
+			return !_jobs.empty();
+		}
+
+		void image_cache::discard_device_resources() {
+			for (auto it = _entries.begin(); it != _entries.end();) {
+				if (it->p_bitmap) {
+					release(*it);
+					_index.erase(it->key);
+					it = _entries.erase(it);
+				}
+				else
+					it++;
+			}
+
+			forget_failures();
+		}
+
+		void image_cache::forget_failures() {
+			_failed.clear();
+		}
+
+		void image_cache::shutdown() {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_stop = true;
+				_queue.clear();
+			}
+
+			_wake.notify_all();
+
+			for (auto& worker : _workers)
+				worker.join();
+
+			_workers.clear();
+
+			// the workers are gone, so the finished jobs can be let go of without the lock
+			_done.clear();
+			_jobs.clear();
+			_file_sources.clear();
+			_failed.clear();
+
+			for (auto& e : _entries)
+				release(e);
+
+			_entries.clear();
+			_index.clear();
+			_bytes = 0;
+		}
+
+		void image_cache::forget_source(const std::string& source) {
+			// the file is looked at again the next time it is asked for, in case it has changed
+			for (auto it = _file_sources.begin(); it != _file_sources.end();) {
+				if (it->second == source)
+					it = _file_sources.erase(it);
+				else
+					it++;
+			}
+		}
+
+		unsigned long long image_cache::hits() const { return _hits; }
+		unsigned long long image_cache::misses() const { return _misses; }
+		size_t image_cache::bytes() const { return _bytes; }
+
+		HRESULT image_cache::decode(IWICImagingFactory* p_IWICFactory, const BYTE* p_data, DWORD data_size,
+			size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality,
+			IWICBitmap** pp_bitmap) {
+			IWICBitmapDecoder* p_decoder = nullptr;
+			IWICBitmap* p_frame = nullptr;
+
+			HRESULT hr = open_memory(p_IWICFactory, p_data, data_size, &p_decoder);
+
+			if (SUCCEEDED(hr))
+				hr = decode_frame(p_IWICFactory, p_decoder, &p_frame);
+
+			if (SUCCEEDED(hr))
+				hr = scale(p_IWICFactory, p_frame, target_size, enlarge_if_smaller, keep_aspect_ratio,
+					quality, pp_bitmap);
+
+			safe_release(&p_frame);
+			safe_release(&p_decoder);
+			return hr;
+		}
+
+		HRESULT image_cache::load_bitmap(const void* p_owner, ID2D1RenderTarget* p_render_target,
+			const std::string& source, const std::function<HRESULT(IWICImagingFactory*, IWICBitmapDecoder**)>& open,
+			ID2D1Bitmap** pp_bitmap, size target_size, bool enlarge_if_smaller,
+			bool keep_aspect_ratio, image_quality quality) {
+			// round the target size up so that small changes in size share a bitmap, which is then
+			// shrunk a little when drawn. An image that is stretched has to be made at the exact size.
+			if (keep_aspect_ratio) {
+				target_size.width(std::ceil(target_size.get_width() / image_cache_size_step) * image_cache_size_step);
+				target_size.height(std::ceil(target_size.get_height() / image_cache_size_step) * image_cache_size_step);
+			}
+
+			const std::string key = source + "|" +
+				std::to_string(static_cast<long>(target_size.get_width())) + "x" +
+				std::to_string(static_cast<long>(target_size.get_height())) + "|" +
+				std::to_string(static_cast<int>(quality)) +
+				(enlarge_if_smaller ? "e" : "") + (keep_aspect_ratio ? "k" : "");
+
+			if (_stop)
+				return E_ABORT;	// shut down
+
+			const auto failed = _failed.find(key);
+
+			if (failed != _failed.end())
+				return failed->second;
+
+			if (auto p_entry = find(key)) {
+				if (p_entry->p_bitmap) {
+					_hits++;
+					*pp_bitmap = p_entry->p_bitmap;
+					(*pp_bitmap)->AddRef();
+					return S_OK;
+				}
+
+				// decoded and scaled by a worker; all that is left is to copy it to the render target
+				HRESULT hr = p_render_target->CreateBitmapFromWicBitmap(p_entry->p_frame, nullptr, pp_bitmap);
+
+				if (SUCCEEDED(hr)) {
+					const auto pixel_size = (*pp_bitmap)->GetPixelSize();
+
+					release(*p_entry);
+					p_entry->p_bitmap = *pp_bitmap;
+					p_entry->p_bitmap->AddRef();
+					p_entry->bytes = static_cast<size_t>(pixel_size.width) * pixel_size.height * 4;
+					_bytes += p_entry->bytes;
+				}
+
+#if IMAGECACHE
+				log("image cache: " + std::to_string(_hits) + " hits, " + std::to_string(_misses) +
+					" misses, " + std::to_string(_bytes / 1024) + " KB in " + std::to_string(_entries.size()) +
+					" entries");
+#endif
+				return hr;
+			}
+
+			auto it = _jobs.find(key);
+
+			if (it != _jobs.end()) {
+				// already asked for
+				std::lock_guard<std::mutex> lock(_mutex);
+				it->second->owners.insert(p_owner);
+				return E_PENDING;
+			}
+
+			_misses++;
+
+			auto p_job = std::make_shared<job>();
+			p_job->key = key;
+			p_job->source = source;
+			p_job->open = open;
+			p_job->target_size = target_size;
+			p_job->enlarge_if_smaller = enlarge_if_smaller;
+			p_job->keep_aspect_ratio = keep_aspect_ratio;
+			p_job->quality = quality;
+			p_job->owners.insert(p_owner);
+
+			// only scale the frame if it has been decoded before
+			if (auto p_entry = find(source)) {
+				p_job->p_frame = p_entry->p_frame;
+				p_job->p_frame->AddRef();
+			}
+
+			_jobs[key] = p_job;
+
+			if (_workers.empty()) {
+				// leave a core for the window thread
+				const unsigned cores = std::thread::hardware_concurrency();
+				const unsigned workers = cores > 2 ? smallest(cores - 1, image_cache_max_workers) : 1;
+
+				for (unsigned i = 0; i < workers; i++)
+					_workers.emplace_back([this]() { work(); });
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_queue.push_back(p_job);
+			}
+
+			_wake.notify_one();
+			return E_PENDING;
+		}
+
+		void image_cache::work() {
+			// each worker has its own apartment and factory
+			const HRESULT hr_com = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+			IWICImagingFactory* p_IWICFactory = nullptr;
+
+			HRESULT hr_factory = hr_com;
+
+			if (SUCCEEDED(hr_factory))
+				hr_factory = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER,
+					IID_PPV_ARGS(&p_IWICFactory));
+
+			while (true) {
+				std::shared_ptr<job> p_job;
+
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					_wake.wait(lock, [this]() { return _stop || !_queue.empty(); });
+
+					if (_stop)
+						break;
+
+					p_job = _queue.front();
+					_queue.pop_front();
+				}
+
+				if (SUCCEEDED(hr_factory))
+					run(p_IWICFactory, *p_job);
+				else
+					p_job->hr = hr_factory;
+
+				std::lock_guard<std::mutex> lock(_mutex);
+				_done.push_back(p_job);
+			}
+
+			safe_release(&p_IWICFactory);
+
+			if (SUCCEEDED(hr_com))
+				CoUninitialize();
+		}
+
+		void image_cache::run(IWICImagingFactory* p_IWICFactory, job& j) {
+			HRESULT hr = S_OK;
+
+			if (!j.p_frame) {
+				IWICBitmapDecoder* p_decoder = nullptr;
+				hr = j.open(p_IWICFactory, &p_decoder);
+
+				if (SUCCEEDED(hr))
+					hr = decode_frame(p_IWICFactory, p_decoder, &j.p_frame);
+
+				safe_release(&p_decoder);
+				j.frame_decoded = SUCCEEDED(hr);
+			}
+
+			if (SUCCEEDED(hr))
+				hr = scale(p_IWICFactory, j.p_frame, j.target_size, j.enlarge_if_smaller,
+					j.keep_aspect_ratio, j.quality, &j.p_scaled);
+
+			j.hr = hr;
+		}
+
+		HRESULT image_cache::open_memory(IWICImagingFactory* p_IWICFactory, const BYTE* p_data, DWORD data_size,
+			IWICBitmapDecoder** pp_decoder) {
+			IWICStream* p_stream = nullptr;
+
+			// Create a WIC stream to map onto the memory.
+			HRESULT hr = p_IWICFactory->CreateStream(&p_stream);
+
+			if (SUCCEEDED(hr))
+				// Initialize the stream with the memory pointer and size.
+				hr = p_stream->InitializeFromMemory(const_cast<BYTE*>(p_data), data_size);
+
+			if (SUCCEEDED(hr))
+				// Create a decoder for the stream.
+				hr = p_IWICFactory->CreateDecoderFromStream(p_stream, nullptr,
+					WICDecodeMetadataCacheOnLoad, pp_decoder);
+
+			// the decoder keeps its own reference to the stream
+			safe_release(&p_stream);
+			return hr;
+		}
+
+		HRESULT image_cache::decode_frame(IWICImagingFactory* p_IWICFactory, IWICBitmapDecoder* p_decoder,
+			IWICBitmap** pp_frame) {
+			IWICBitmapFrameDecode* p_source = nullptr;
+			IWICFormatConverter* p_converter = nullptr;
+
+			HRESULT hr = p_decoder->GetFrame(0, &p_source);
+
+			// Convert the image format to 32bppPBGRA
+			// (DXGI_FORMAT_B8G8R8A8_UNORM + D2D1_ALPHA_MODE_PREMULTIPLIED).
+			if (SUCCEEDED(hr))
+				hr = p_IWICFactory->CreateFormatConverter(&p_converter);
+
+			if (SUCCEEDED(hr))
+				hr = p_converter->Initialize(p_source, GUID_WICPixelFormat32bppPBGRA,
+					WICBitmapDitherTypeNone, nullptr, 0.f, WICBitmapPaletteTypeMedianCut);
+
+			// decode the whole frame into memory
+			if (SUCCEEDED(hr))
+				hr = p_IWICFactory->CreateBitmapFromSource(p_converter, WICBitmapCacheOnLoad, pp_frame);
+
+			safe_release(&p_converter);
+			safe_release(&p_source);
+			return hr;
+		}
+
+		HRESULT image_cache::scale(IWICImagingFactory* p_IWICFactory, IWICBitmap* p_frame,
+			size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality,
+			IWICBitmap** pp_scaled) {
+			UINT original_width = 0;
+			UINT original_height = 0;
+			HRESULT hr = p_frame->GetSize(&original_width, &original_height);
+
+			if (FAILED(hr))
+				return hr;
+
+			D2D1_RECT_F rect_container = { 0.f, 0.f, target_size.get_width(), target_size.get_height() };
+			D2D1_RECT_F rect = { 0.f, 0.f,
+				static_cast<float>(original_width), static_cast<float>(original_height) };
+			fit_rect(rect_container, rect, enlarge_if_smaller, keep_aspect_ratio, false);
+			const auto new_width = static_cast<UINT>(rect.right - rect.left);
+			const auto new_height = static_cast<UINT>(rect.bottom - rect.top);
+
+			if (new_width == original_width && new_height == original_height) {
+				// don't scale image
+				*pp_scaled = p_frame;
+				(*pp_scaled)->AddRef();
+				return S_OK;
+			}
+
+			// scale image
+			IWICBitmapScaler* p_scaler = nullptr;
+			hr = p_IWICFactory->CreateBitmapScaler(&p_scaler);
+
+			if (SUCCEEDED(hr)) {
+				WICBitmapInterpolationMode mode;
+				switch (quality) {
+				case image_quality::low:
+					mode = WICBitmapInterpolationModeNearestNeighbor;
+					break;
+				case image_quality::high:
+					mode = WICBitmapInterpolationModeHighQualityCubic;
+					break;
+				case image_quality::medium:
+				default:
+					mode = WICBitmapInterpolationModeLinear;
+					break;
+				}
+				hr = p_scaler->Initialize(p_frame, new_width, new_height, mode);
+			}
+
+			// scale now rather than when the bitmap is made on the window thread
+			if (SUCCEEDED(hr))
+				hr = p_IWICFactory->CreateBitmapFromSource(p_scaler, WICBitmapCacheOnLoad, pp_scaled);
+
+			safe_release(&p_scaler);
+			return hr;
+		}
+
+		image_cache::entry* image_cache::find(const std::string& key) {
+			auto it = _index.find(key);
+
+			if (it == _index.end())
+				return nullptr;
+
+			_entries.splice(_entries.begin(), _entries, it->second);	// make it the most recently used
+			return &_entries.front();
+		}
+
+		image_cache::entry& image_cache::add(const std::string& key) {
+			_entries.emplace_front();
+			_entries.front().key = key;
+			_index[key] = _entries.begin();
+			return _entries.front();
+		}
+
+		void image_cache::trim() {
+			// drop the least recently used entries, but never the one just used
+			while (_bytes > image_cache_budget && _entries.size() > 1) {
+				release(_entries.back());
+				_index.erase(_entries.back().key);
+				_entries.pop_back();
+			}
+		}
+
+		void image_cache::release(entry& e) {
+			safe_release(&e.p_frame);
+			safe_release(&e.p_bitmap);
+			_bytes -= e.bytes;
+			e.bytes = 0;
+		}
+	}
+}
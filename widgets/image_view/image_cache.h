@@ -0,0 +1,190 @@
+//
+// image_cache.h - image cache interface
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#pragma once
+
+#include "../../form_common.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace liblec {
+	namespace lecui {
+		/// <summary>A form-wide cache of the images shown by the form's widgets.</summary>
+		/// <remarks>An image is decoded once at full resolution and the decoded frame is shared
+		/// by every widget that shows it, so that a widget that has changed size only needs the
+		/// frame to be scaled again. The scaled bitmaps are kept too, keyed on the image, the
+		/// target size and the scaling options, so that widgets showing the same image at the
+		/// same size share one bitmap. The least recently used frames and bitmaps are dropped
+		/// when the memory they take up exceeds the cache's budget.
+		///
+		/// Decoding and scaling are done by a pool of worker threads so that the window thread
+		/// never waits for them. A bitmap that isn't ready yet is reported as pending, and the
+		/// finished work is picked up on the window thread by calling collect().</remarks>
+		class image_cache {
+		public:
+			image_cache() {}
+			~image_cache();
+
+			/// <summary>Get a bitmap of a resource image.</summary>
+			/// <param name="p_owner">The widget asking for the bitmap, for cancelling the request
+			/// through cancel().</param>
+			/// <returns>The result of the operation. E_PENDING if the image is being decoded. On
+			/// success the bitmap has a reference added for the caller to release.</returns>
+			/// <remarks>The other parameters are as in load_bitmap_resource.</remarks>
+			HRESULT load_bitmap_resource(const void* p_owner, ID2D1RenderTarget* p_render_target,
+				HINSTANCE h_inst, int id_image, const std::string& resource_type, ID2D1Bitmap** pp_bitmap,
+				size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality);
+
+			/// <summary>Get a bitmap of an image file.</summary>
+			/// <param name="p_owner">The widget asking for the bitmap, for cancelling the request
+			/// through cancel().</param>
+			/// <returns>The result of the operation. E_PENDING if the image is being decoded. On
+			/// success the bitmap has a reference added for the caller to release.</returns>
+			/// <remarks>The other parameters are as in load_bitmap_file.</remarks>
+			HRESULT load_bitmap_file(const void* p_owner, ID2D1RenderTarget* p_render_target,
+				const std::string& file, ID2D1Bitmap** pp_bitmap,
+				size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality);
+
+			/// <summary>Withdraw a widget's requests. Images that no other widget is waiting for
+			/// are not decoded, unless a worker has already started on them.</summary>
+			/// <param name="p_owner">The widget.</param>
+			void cancel(const void* p_owner);
+
+			/// <summary>Pick up the images that the workers have finished with.</summary>
+			/// <returns>True if any were finished, in which case the widgets waiting for them
+			/// need to be drawn again.</returns>
+			bool collect();
+
+			/// <summary>Check whether any images are being decoded.</summary>
+			bool pending() const;
+
+			/// <summary>Release the bitmaps, which belong to the render target, but keep the
+			/// decoded frames. Images that failed to load are tried again.</summary>
+			/// <remarks>Call when the render target is discarded.</remarks>
+			void discard_device_resources();
+
+			/// <summary>Forget the images that failed to load, so that they are tried again the
+			/// next time they are asked for.</summary>
+			void forget_failures();
+
+			/// <summary>Stop the workers and release everything in the cache. No images are
+			/// loaded afterwards.</summary>
+			/// <remarks>Call before COM is uninitialized.</remarks>
+			void shutdown();
+
+			/// <summary>The number of bitmaps that were found in the cache.</summary>
+			unsigned long long hits() const;
+
+			/// <summary>The number of bitmaps that had to be made.</summary>
+			unsigned long long misses() const;
+
+			/// <summary>The memory taken up by the cached frames and bitmaps, in bytes.</summary>
+			size_t bytes() const;
+
+			/// <summary>Decode an image that is in memory and scale it, the way the workers do.
+			/// </summary>
+			/// <param name="p_IWICFactory">The WIC factory.</param>
+			/// <param name="p_data">The image file's data, e.g. that of a PNG.</param>
+			/// <param name="data_size">The size of the data, in bytes.</param>
+			/// <param name="pp_bitmap">The decoded image, in 32bppPBGRA format.</param>
+			/// <returns>The result of the operation.</returns>
+			/// <remarks>The other parameters are as in load_bitmap_resource. Needs neither a
+			/// window nor a render target.</remarks>
+			static HRESULT decode(IWICImagingFactory* p_IWICFactory, const BYTE* p_data, DWORD data_size,
+				size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality,
+				IWICBitmap** pp_bitmap);
+
+		private:
+			struct entry {
+				std::string key;
+				IWICBitmap* p_frame = nullptr;		// a decoded frame, or a scaled image that is yet to be made into a bitmap
+				ID2D1Bitmap* p_bitmap = nullptr;	// a scaled bitmap
+				size_t bytes = 0;
+			};
+
+			struct job {
+				std::string key;
+				std::string source;
+				std::function<HRESULT(IWICImagingFactory*, IWICBitmapDecoder**)> open;	// called by the worker
+				size target_size;
+				bool enlarge_if_smaller = false;
+				bool keep_aspect_ratio = false;
+				image_quality quality = image_quality::medium;
+				std::unordered_set<const void*> owners;
+
+				IWICBitmap* p_frame = nullptr;	// given if the frame is in the cache, else decoded by the worker
+				bool frame_decoded = false;
+				IWICBitmap* p_scaled = nullptr;
+				HRESULT hr = S_OK;
+
+				~job() {
+					safe_release(&p_frame);
+					safe_release(&p_scaled);
+				}
+			};
+
+			HRESULT load_bitmap(const void* p_owner, ID2D1RenderTarget* p_render_target,
+				const std::string& source, const std::function<HRESULT(IWICImagingFactory*, IWICBitmapDecoder**)>& open,
+				ID2D1Bitmap** pp_bitmap, size target_size, bool enlarge_if_smaller,
+				bool keep_aspect_ratio, image_quality quality);
+
+			void work();
+			static void run(IWICImagingFactory* p_IWICFactory, job& j);
+			static HRESULT open_memory(IWICImagingFactory* p_IWICFactory, const BYTE* p_data, DWORD data_size,
+				IWICBitmapDecoder** pp_decoder);
+			static HRESULT decode_frame(IWICImagingFactory* p_IWICFactory, IWICBitmapDecoder* p_decoder,
+				IWICBitmap** pp_frame);
+			static HRESULT scale(IWICImagingFactory* p_IWICFactory, IWICBitmap* p_frame,
+				size target_size, bool enlarge_if_smaller, bool keep_aspect_ratio, image_quality quality,
+				IWICBitmap** pp_scaled);
+
+			entry* find(const std::string& key);
+			entry& add(const std::string& key);
+			void trim();
+			void release(entry& e);
+			void forget_source(const std::string& source);
+
+			std::list<entry> _entries;	// most recently used first
+			std::unordered_map<std::string, std::list<entry>::iterator> _index;
+			std::unordered_map<std::string, HRESULT> _failed;
+			size_t _bytes = 0;
+			unsigned long long _hits = 0;
+			unsigned long long _misses = 0;
+
+			// the requests that are queued or being worked on, by the key of the bitmap
+			std::unordered_map<std::string, std::shared_ptr<job>> _jobs;
+
+			// the sources of the files that have requests in _jobs, by file name
+			std::unordered_map<std::string, std::string> _file_sources;
+
+			// shared with the workers
+			std::mutex _mutex;
+			std::condition_variable _wake;
+			std::deque<std::shared_ptr<job>> _queue;
+			std::vector<std::shared_ptr<job>> _done;
+			bool _stop = false;
+
+			std::vector<std::thread> _workers;
+
+			// Copying an object of this class is not allowed
+			image_cache(const image_cache&) = delete;
+			image_cache& operator=(const image_cache&) = delete;
+		};
+	}
+}
@@ -66,59 +66,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::image_view::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::image_view::cursor() { _generation++; return _cursor; }
 
 		widgets::image_view& widgets::image_view::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::image_view::font() { return _font; }
+		std::string& widgets::image_view::font() { _generation++; return _font; }
 
 		widgets::image_view& widgets::image_view::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::image_view::font_size() { return _font_size; }
+		float& widgets::image_view::font_size() { _generation++; return _font_size; }
 
 		widgets::image_view& widgets::image_view::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::image_view::color_text() { return _color_text; }
+		color& widgets::image_view::color_text() { _generation++; return _color_text; }
 
 		widgets::image_view& widgets::image_view::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::image_view::color_fill() { return _color_fill; }
+		color& widgets::image_view::color_fill() { _generation++; return _color_fill; }
 
 		widgets::image_view& widgets::image_view::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::image_view::color_hot() { return _color_hot; }
+		color& widgets::image_view::color_hot() { _generation++; return _color_hot; }
 
 		widgets::image_view& widgets::image_view::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::image_view::color_selected() { return _color_selected; }
+		color& widgets::image_view::color_selected() { _generation++; return _color_selected; }
 
 		widgets::image_view& widgets::image_view::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::image_view::color_disabled() { return _color_disabled; }
+		color& widgets::image_view::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::image_view& widgets::image_view::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -129,10 +137,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::image_view::color_border() { return _color_border; }
+		lecui::color& widgets::image_view::color_border() { _generation++; return _color_border; }
 
 		widgets::image_view& widgets::image_view::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -150,38 +159,43 @@ namespace liblec {
 			return *this;
 		}
 
-		int& widgets::image_view::png_resource() { return _png_resource; }
+		int& widgets::image_view::png_resource() { _generation++; return _png_resource; }
 
 		widgets::image_view& widgets::image_view::png_resource(const int& png_resource) {
 			_png_resource = png_resource;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::image_view::file() { return _file; }
+		std::string& widgets::image_view::file() { _generation++; return _file; }
 
 		widgets::image_view& widgets::image_view::file(const std::string& file) {
 			_file = file;
+			_generation++;
 			return *this;
 		}
 
-		lecui::image_quality& widgets::image_view::quality() { return _quality; }
+		lecui::image_quality& widgets::image_view::quality() { _generation++; return _quality; }
 
 		widgets::image_view& widgets::image_view::quality(const image_quality& quality) {
 			_quality = quality;
+			_generation++;
 			return *this;
 		}
 
-		bool& widgets::image_view::enlarge_if_smaller() { return _enlarge_if_smaller; }
+		bool& widgets::image_view::enlarge_if_smaller() { _generation++; return _enlarge_if_smaller; }
 
 		widgets::image_view& widgets::image_view::enlarge_if_smaller(const bool& enlarge_if_smaller) {
 			_enlarge_if_smaller = enlarge_if_smaller;
+			_generation++;
 			return *this;
 		}
 
-		bool& widgets::image_view::keep_aspect_ratio() { return _keep_aspect_ratio; }
+		bool& widgets::image_view::keep_aspect_ratio() { _generation++; return _keep_aspect_ratio; }
 
 		widgets::image_view& widgets::image_view::keep_aspect_ratio(const bool& keep_aspect_ratio) {
 			_keep_aspect_ratio = keep_aspect_ratio;
+			_generation++;
 			return *this;
 		}
 
@@ -280,26 +294,12 @@ namespace liblec {
 
 		widgets::image_view&
 			widgets::image_view_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_image_view_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_image_view_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_image_view_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -25,6 +25,7 @@ namespace liblec {
 			_p_brush_disabled(nullptr),
 			_p_brush_selected(nullptr),
 			_p_bitmap(nullptr),
+			_bitmap_pending(false),
 			_p_IWICFactory(p_IWICFactory),
 			_old_size({ 0.f, 0.f }),
 			_p_directwrite_factory(p_directwrite_factory),
@@ -39,7 +40,6 @@ namespace liblec {
 
 		HRESULT widgets::image_view_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = (_specs.events().click == nullptr && _specs.events().action == nullptr);
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -76,6 +76,7 @@ namespace liblec {
 			safe_release(&_p_brush_disabled);
 			safe_release(&_p_brush_selected);
 			safe_release(&_p_bitmap);
+			cancel_bitmap();
 
 			// discard badge resources
 			discard_badge_resources(_badge_resources);
@@ -84,12 +85,14 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::image_view_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -116,20 +119,28 @@ namespace liblec {
 			const size current_size = { _rect.right - _rect.left, _rect.bottom - _rect.top };
 
 			if ((current_size.get_width() != _old_size.get_width()) ||
-				current_size.get_height() != _old_size.get_height())
+				current_size.get_height() != _old_size.get_height()) {
 				safe_release(&_p_bitmap);
+				cancel_bitmap();	// the image is wanted at the new size instead
+			}
 
 			if (!_p_bitmap) {
 				// make a dpi scaled target size
 				const size target_size{ current_size.get_width() * get_dpi_scale(), current_size.get_height() * get_dpi_scale() };
+				auto& image_cache = _page._d_page.get_form()._d._image_cache;
+				HRESULT hr = E_FAIL;
 
+				// the image is decoded in the background and the fill above stands in for it until
+				// it is ready, when the form is updated
 				if (_specs.png_resource())	// png resource takes precedence
-					load_bitmap_resource(p_render_target, _p_IWICFactory,
+					hr = image_cache.load_bitmap_resource(this, p_render_target,
 						_page._d_page.get_form()._d._resource_module_handle, _specs.png_resource(), "PNG",
 						&_p_bitmap, target_size, _specs.enlarge_if_smaller(), _specs.keep_aspect_ratio(), _specs.quality());
-				if (!_specs.file().empty() && !_p_bitmap)
-					load_bitmap_file(p_render_target, _p_IWICFactory, convert_string(_specs.file()).c_str(),
+				if (!_specs.file().empty() && FAILED(hr) && hr != E_PENDING)
+					hr = image_cache.load_bitmap_file(this, p_render_target, _specs.file(),
 						&_p_bitmap, target_size, _specs.enlarge_if_smaller(), _specs.keep_aspect_ratio(), _specs.quality());
+
+				_bitmap_pending = hr == E_PENDING;
 			}
 
 			if (_p_bitmap) {
@@ -251,6 +262,18 @@ namespace liblec {
 			return _rect;
 		}
 
+		void widgets::image_view_impl::on_culled() {
+			cancel_bitmap();
+		}
+
+		void widgets::image_view_impl::cancel_bitmap() {
+			if (!_bitmap_pending)
+				return;
+
+			_bitmap_pending = false;
+			_page._d_page.get_form()._d._image_cache.cancel(this);
+		}
+
 		widgets::image_view&
 			widgets::image_view_impl::specs() { return _specs; }
 
@@ -38,6 +38,7 @@ namespace liblec {
 				D2D1_RECT_F& render(ID2D1HwndRenderTarget* p_render_target,
 					const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset,
 					const bool& render) override;
+				void on_culled() override;
 
 				/// widget specific methods
 				widgets::image_view& specs();
@@ -49,14 +50,18 @@ namespace liblec {
 				image_view_impl(const image_view_impl&) = delete;
 				image_view_impl& operator=(const image_view_impl&) = delete;
 
+				/// <summary>Withdraw the request for the bitmap if it is still being decoded.</summary>
+				void cancel_bitmap();
+
 				/// Private variables
-				widgets::image_view _specs, _specs_old;
+				widgets::image_view _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_border;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
 				ID2D1SolidColorBrush* _p_brush_selected;
 				ID2D1Bitmap* _p_bitmap;
+				bool _bitmap_pending;
 				IWICImagingFactory* _p_IWICFactory;
 
 				IDWriteFactory* _p_directwrite_factory;
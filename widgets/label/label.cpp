@@ -30,10 +30,11 @@ namespace liblec {
 			return !operator==(param);
 		}
 
-		std::string& widgets::label::text() { return _text; }
+		std::string& widgets::label::text() { _generation++; return _text; }
 
 		widgets::label& widgets::label::text(const std::string& text) {
 			_text = text;
+			_generation++;
 			return *this;
 		}
 
@@ -58,87 +59,99 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::label::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::label::cursor() { _generation++; return _cursor; }
 
 		widgets::label& widgets::label::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::label::font() { return _font; }
+		std::string& widgets::label::font() { _generation++; return _font; }
 
 		widgets::label& widgets::label::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::label::font_size() { return _font_size; }
+		float& widgets::label::font_size() { _generation++; return _font_size; }
 
 		widgets::label& widgets::label::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::label::color_text() { return _color_text; }
+		color& widgets::label::color_text() { _generation++; return _color_text; }
 
 		widgets::label& widgets::label::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::label::color_fill() { return _color_fill; }
+		color& widgets::label::color_fill() { _generation++; return _color_fill; }
 
 		widgets::label& widgets::label::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::label::color_hot() { return _color_hot; }
+		color& widgets::label::color_hot() { _generation++; return _color_hot; }
 
 		widgets::label& widgets::label::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::label::color_selected() { return _color_selected; }
+		color& widgets::label::color_selected() { _generation++; return _color_selected; }
 
 		widgets::label& widgets::label::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::label::color_disabled() { return _color_disabled; }
+		color& widgets::label::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::label& widgets::label::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::label::color_hot_pressed() { return _color_hot_pressed; }
+		lecui::color& widgets::label::color_hot_pressed() { _generation++; return _color_hot_pressed; }
 
 		widgets::label& widgets::label::color_hot_pressed(const color& color_hot_pressed) {
 			_color_hot_pressed = color_hot_pressed;
+			_generation++;
 			return *this;
 		}
 
-		bool& widgets::label::multiline() { return _multiline; }
+		bool& widgets::label::multiline() { _generation++; return _multiline; }
 
 		widgets::label& widgets::label::multiline(const bool& multiline) {
 			_multiline = multiline;
+			_generation++;
 			return *this;
 		}
 
-		text_alignment& widgets::label::alignment() { return _alignment; }
+		text_alignment& widgets::label::alignment() { _generation++; return _alignment; }
 
 		widgets::label& widgets::label::alignment(const text_alignment& alignment) {
 			_alignment = alignment;
+			_generation++;
 			return *this;
 		}
 
-		lecui::paragraph_alignment& widgets::label::paragraph_alignment() { return _paragraph_alignment; }
+		lecui::paragraph_alignment& widgets::label::paragraph_alignment() { _generation++; return _paragraph_alignment; }
 
 		widgets::label& widgets::label::paragraph_alignment(const lecui::paragraph_alignment& paragraph_alignment) {
 			_paragraph_alignment = paragraph_alignment;
+			_generation++;
 			return *this;
 		}
 
@@ -227,26 +240,12 @@ namespace liblec {
 		widgets::label&
 			widgets::label_builder::specs(form& fm,
 				const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_label_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_label_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_label_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
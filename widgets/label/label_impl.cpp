@@ -18,10 +18,9 @@ namespace liblec {
 			const std::string& formatted_text,
 			std::string& _plain_text,
 			D2D1_COLOR_F default_color,
-			std::vector<formatted_text_parser::text_range_properties>& _formatting) {
-			const auto props = formatted_text_parser().read(formatted_text, default_color);
-			_plain_text = props.xml.plain_text;
-			_formatting = props.dwrite;
+			std::shared_ptr<const formatted_text_parser::formatted_text_properties>& _formatting) {
+			_formatting = formatted_text_parser().read_cached(formatted_text, default_color);
+			_plain_text = _formatting->xml.plain_text;
 		}
 
 		void widgets::apply_formatting(
@@ -74,7 +73,7 @@ namespace liblec {
 				const D2D1_RECT_F max_rect) {
 			// the default color doesn't matter here we're just measuring the text
 			std::string _plain_text;
-			std::vector<formatted_text_parser::text_range_properties> _formatting;
+			std::shared_ptr<const formatted_text_parser::formatted_text_properties> _formatting;
 			parse_formatted_text(formatted_text, _plain_text, D2D1::ColorF(D2D1::ColorF::Black), _formatting);
 
 			D2D1_RECT_F rect = max_rect;
@@ -135,7 +134,7 @@ namespace liblec {
 			}
 
 			if (SUCCEEDED(hr)) {
-				apply_formatting(_formatting, nullptr, _p_text_layout, true, nullptr);
+				apply_formatting(_formatting->dwrite, nullptr, _p_text_layout, true, nullptr);
 
 				DWRITE_TEXT_METRICS textMetrics;
 				_p_text_layout->GetMetrics(&textMetrics);
@@ -163,7 +162,7 @@ namespace liblec {
 				const D2D1_RECT_F max_rect) {
 			// the default color doesn't matter here we're just measuring the text
 			std::string _plain_text;
-			std::vector<formatted_text_parser::text_range_properties> _formatting;
+			std::shared_ptr<const formatted_text_parser::formatted_text_properties> _formatting;
 			parse_formatted_text(formatted_text, _plain_text, D2D1::ColorF(D2D1::ColorF::Black), _formatting);
 
 			D2D1_RECT_F rect = max_rect;
@@ -229,7 +228,7 @@ namespace liblec {
 			}
 
 			if (SUCCEEDED(hr)) {
-				apply_formatting(_formatting, nullptr, _p_text_layout, true, nullptr);
+				apply_formatting(_formatting->dwrite, nullptr, _p_text_layout, true, nullptr);
 
 				DWRITE_TEXT_METRICS textMetrics;
 				_p_text_layout->GetMetrics(&textMetrics);
@@ -275,7 +274,6 @@ namespace liblec {
 
 		HRESULT widgets::label_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = (_specs.events().click == nullptr && _specs.events().action == nullptr);
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -363,12 +361,14 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::label_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -386,8 +386,9 @@ namespace liblec {
 			DWRITE_TEXT_METRICS textMetrics;
 
 			if (SUCCEEDED(hr)) {
-				apply_formatting(_formatting, p_render_target, _p_text_layout, _is_enabled,
-					_p_brush_disabled);
+				if (_formatting)
+					apply_formatting(_formatting->dwrite, p_render_target, _p_text_layout, _is_enabled,
+						_p_brush_disabled);
 
 				_p_text_layout->GetMetrics(&textMetrics);
 				const auto rect_text = _rect;
@@ -17,10 +17,12 @@
 namespace liblec {
 	namespace lecui {
 		namespace widgets {
+			/// parse formatted text. The formatting is shared with the parser's cache and other
+			/// readers of the same text, so it is handed out rather than copied
 			void parse_formatted_text(const std::string& formatted_text,
 				std::string& _plain_text,
 				D2D1_COLOR_F default_color,
-				std::vector<formatted_text_parser::text_range_properties>& _formatting);
+				std::shared_ptr<const formatted_text_parser::formatted_text_properties>& _formatting);
 
 			void apply_formatting(const std::vector<formatted_text_parser::text_range_properties>& _formatting,
 				ID2D1HwndRenderTarget* p_render_target,
@@ -78,7 +80,7 @@ namespace liblec {
 				label_impl& operator=(const label_impl&) = delete;
 
 				/// Private variables
-				widgets::label _specs, _specs_old;
+				widgets::label _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_hot_pressed;
@@ -90,7 +92,7 @@ namespace liblec {
 				IDWriteTextLayout* _p_text_layout;
 
 				std::string _text;
-				std::vector<formatted_text_parser::text_range_properties> _formatting;
+				std::shared_ptr<const formatted_text_parser::formatted_text_properties> _formatting;
 			};
 		}
 	}
@@ -47,7 +47,7 @@ namespace liblec {
 				line_impl& operator=(const line_impl&) = delete;
 
 				/// Private variables
-				widgets::line _specs, _specs_old;
+				widgets::line _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
@@ -55,59 +55,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::progress_bar::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::progress_bar::cursor() { _generation++; return _cursor; }
 
 		widgets::progress_bar& widgets::progress_bar::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::progress_bar::font() { return _font; }
+		std::string& widgets::progress_bar::font() { _generation++; return _font; }
 
 		widgets::progress_bar& widgets::progress_bar::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::progress_bar::font_size() { return _font_size; }
+		float& widgets::progress_bar::font_size() { _generation++; return _font_size; }
 
 		widgets::progress_bar& widgets::progress_bar::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_bar::color_text() { return _color_text; }
+		color& widgets::progress_bar::color_text() { _generation++; return _color_text; }
 
 		widgets::progress_bar& widgets::progress_bar::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_bar::color_fill() { return _color_fill; }
+		color& widgets::progress_bar::color_fill() { _generation++; return _color_fill; }
 
 		widgets::progress_bar& widgets::progress_bar::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_bar::color_hot() { return _color_hot; }
+		color& widgets::progress_bar::color_hot() { _generation++; return _color_hot; }
 
 		widgets::progress_bar& widgets::progress_bar::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_bar::color_selected() { return _color_selected; }
+		color& widgets::progress_bar::color_selected() { _generation++; return _color_selected; }
 
 		widgets::progress_bar& widgets::progress_bar::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_bar::color_disabled() { return _color_disabled; }
+		color& widgets::progress_bar::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::progress_bar& widgets::progress_bar::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -118,17 +126,19 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::progress_bar::color_border() { return _color_border; }
+		lecui::color& widgets::progress_bar::color_border() { _generation++; return _color_border; }
 
 		widgets::progress_bar& widgets::progress_bar::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_bar::color_empty() { return _color_empty; }
+		color& widgets::progress_bar::color_empty() { _generation++; return _color_empty; }
 
 		widgets::progress_bar& widgets::progress_bar::color_empty(const color& color_empty) {
 			_color_empty = color_empty;
+			_generation++;
 			return *this;
 		}
 
@@ -221,26 +231,12 @@ namespace liblec {
 
 		widgets::progress_bar&
 			widgets::progress_bar_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_progress_bar_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_progress_bar_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_progress_bar_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -54,66 +54,75 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::progress_indicator::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::progress_indicator::cursor() { _generation++; return _cursor; }
 
 		widgets::progress_indicator& widgets::progress_indicator::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::progress_indicator::font() { return _font; }
+		std::string& widgets::progress_indicator::font() { _generation++; return _font; }
 
 		widgets::progress_indicator& widgets::progress_indicator::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::progress_indicator::font_size() { return _font_size; }
+		float& widgets::progress_indicator::font_size() { _generation++; return _font_size; }
 
 		widgets::progress_indicator& widgets::progress_indicator::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_indicator::color_text() { return _color_text; }
+		color& widgets::progress_indicator::color_text() { _generation++; return _color_text; }
 
 		widgets::progress_indicator& widgets::progress_indicator::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_indicator::color_fill() { return _color_fill; }
+		color& widgets::progress_indicator::color_fill() { _generation++; return _color_fill; }
 
 		widgets::progress_indicator& widgets::progress_indicator::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_indicator::color_hot() { return _color_hot; }
+		color& widgets::progress_indicator::color_hot() { _generation++; return _color_hot; }
 
 		widgets::progress_indicator& widgets::progress_indicator::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_indicator::color_selected() { return _color_selected; }
+		color& widgets::progress_indicator::color_selected() { _generation++; return _color_selected; }
 
 		widgets::progress_indicator& widgets::progress_indicator::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_indicator::color_disabled() { return _color_disabled; }
+		color& widgets::progress_indicator::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::progress_indicator& widgets::progress_indicator::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::progress_indicator::color_empty() { return _color_empty; }
+		color& widgets::progress_indicator::color_empty() { _generation++; return _color_empty; }
 
 		widgets::progress_indicator& widgets::progress_indicator::color_empty(const color& color_empty) {
 			_color_empty = color_empty;
+			_generation++;
 			return *this;
 		}
 
@@ -227,26 +236,12 @@ namespace liblec {
 
 		widgets::progress_indicator&
 			widgets::progress_indicator_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_progress_indicator_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_progress_indicator_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_progress_indicator_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -49,7 +49,7 @@ namespace liblec {
 				progress_indicator_impl& operator=(const progress_indicator_impl&) = delete;
 
 				/// Private variables
-				widgets::progress_indicator _specs, _specs_old;
+				widgets::progress_indicator _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_empty;
 				ID2D1SolidColorBrush* _p_brush_fill;
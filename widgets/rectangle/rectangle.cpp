@@ -62,59 +62,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::rectangle::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::rectangle::cursor() { _generation++; return _cursor; }
 
 		widgets::rectangle& widgets::rectangle::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::rectangle::font() { return _font; }
+		std::string& widgets::rectangle::font() { _generation++; return _font; }
 
 		widgets::rectangle& widgets::rectangle::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::rectangle::font_size() { return _font_size; }
+		float& widgets::rectangle::font_size() { _generation++; return _font_size; }
 
 		widgets::rectangle& widgets::rectangle::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::rectangle::color_text() { return _color_text; }
+		color& widgets::rectangle::color_text() { _generation++; return _color_text; }
 
 		widgets::rectangle& widgets::rectangle::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::rectangle::color_fill() { return _color_fill; }
+		color& widgets::rectangle::color_fill() { _generation++; return _color_fill; }
 
 		widgets::rectangle& widgets::rectangle::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::rectangle::color_hot() { return _color_hot; }
+		color& widgets::rectangle::color_hot() { _generation++; return _color_hot; }
 
 		widgets::rectangle& widgets::rectangle::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::rectangle::color_selected() { return _color_selected; }
+		color& widgets::rectangle::color_selected() { _generation++; return _color_selected; }
 
 		widgets::rectangle& widgets::rectangle::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::rectangle::color_disabled() { return _color_disabled; }
+		color& widgets::rectangle::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::rectangle& widgets::rectangle::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -125,17 +133,19 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::rectangle::color_border() { return _color_border; }
+		lecui::color& widgets::rectangle::color_border() { _generation++; return _color_border; }
 
 		widgets::rectangle& widgets::rectangle::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::rectangle::color_border_hot() { return _color_border_hot; }
+		lecui::color& widgets::rectangle::color_border_hot() { _generation++; return _color_border_hot; }
 
 		widgets::rectangle& widgets::rectangle::color_border_hot(const color& color_border_hot) {
 			_color_border_hot = color_border_hot;
+			_generation++;
 			return *this;
 		}
 
@@ -243,26 +253,12 @@ namespace liblec {
 
 		widgets::rectangle&
 			widgets::rectangle_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_rectangle_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_rectangle_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_rectangle_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
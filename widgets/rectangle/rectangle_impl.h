@@ -61,7 +61,7 @@ namespace liblec {
 				rectangle_impl& operator=(const rectangle_impl&) = delete;
 
 				/// Private variables
-				widgets::rectangle _specs, _specs_old;
+				widgets::rectangle _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_border;
 				ID2D1SolidColorBrush* _p_brush_border_hot;
@@ -58,59 +58,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::slider::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::slider::cursor() { _generation++; return _cursor; }
 
 		widgets::slider& widgets::slider::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::slider::font() { return _font; }
+		std::string& widgets::slider::font() { _generation++; return _font; }
 
 		widgets::slider& widgets::slider::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::slider::font_size() { return _font_size; }
+		float& widgets::slider::font_size() { _generation++; return _font_size; }
 
 		widgets::slider& widgets::slider::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::slider::color_text() { return _color_text; }
+		color& widgets::slider::color_text() { _generation++; return _color_text; }
 
 		widgets::slider& widgets::slider::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::slider::color_fill() { return _color_fill; }
+		color& widgets::slider::color_fill() { _generation++; return _color_fill; }
 
 		widgets::slider& widgets::slider::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::slider::color_hot() { return _color_hot; }
+		color& widgets::slider::color_hot() { _generation++; return _color_hot; }
 
 		widgets::slider& widgets::slider::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::slider::color_selected() { return _color_selected; }
+		color& widgets::slider::color_selected() { _generation++; return _color_selected; }
 
 		widgets::slider& widgets::slider::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::slider::color_disabled() { return _color_disabled; }
+		color& widgets::slider::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::slider& widgets::slider::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -121,38 +129,43 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::slider::color_border() { return _color_border; }
+		lecui::color& widgets::slider::color_border() { _generation++; return _color_border; }
 
 		widgets::slider& widgets::slider::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::slider::color_knob() { return _color_knob; }
+		lecui::color& widgets::slider::color_knob() { _generation++; return _color_knob; }
 
 		widgets::slider& widgets::slider::color_knob(const color& color_knob) {
 			_color_knob = color_knob;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::slider::color_knob_hot() { return _color_knob_hot; }
+		lecui::color& widgets::slider::color_knob_hot() { _generation++; return _color_knob_hot; }
 
 		widgets::slider& widgets::slider::color_knob_hot(const color& color_knob_hot) {
 			_color_knob_hot = color_knob_hot;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::slider::color_knob_border() { return _color_knob_border; }
+		lecui::color& widgets::slider::color_knob_border() { _generation++; return _color_knob_border; }
 
 		widgets::slider& widgets::slider::color_knob_border(const color& color_knob_border) {
 			_color_knob_border = color_knob_border;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::slider::color_tick() { return _color_tick; }
+		lecui::color& widgets::slider::color_tick() { _generation++; return _color_tick; }
 
 		widgets::slider& widgets::slider::color_tick(const color& color_tick) {
 			_color_tick = color_tick;
+			_generation++;
 			return *this;
 		}
 
@@ -307,26 +320,12 @@ namespace liblec {
 
 		widgets::slider&
 			widgets::slider_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_slider_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_slider_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_slider_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -54,7 +54,7 @@ namespace liblec {
 				slider_impl& operator=(const slider_impl&) = delete;
 
 				/// Private variables
-				widgets::slider _specs, _specs_old;
+				widgets::slider _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_border;
@@ -55,59 +55,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::strength_bar::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::strength_bar::cursor() { _generation++; return _cursor; }
 
 		widgets::strength_bar& widgets::strength_bar::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::strength_bar::font() { return _font; }
+		std::string& widgets::strength_bar::font() { _generation++; return _font; }
 
 		widgets::strength_bar& widgets::strength_bar::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::strength_bar::font_size() { return _font_size; }
+		float& widgets::strength_bar::font_size() { _generation++; return _font_size; }
 
 		widgets::strength_bar& widgets::strength_bar::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::strength_bar::color_text() { return _color_text; }
+		color& widgets::strength_bar::color_text() { _generation++; return _color_text; }
 
 		widgets::strength_bar& widgets::strength_bar::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::strength_bar::color_fill() { return _color_fill; }
+		color& widgets::strength_bar::color_fill() { _generation++; return _color_fill; }
 
 		widgets::strength_bar& widgets::strength_bar::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::strength_bar::color_hot() { return _color_hot; }
+		color& widgets::strength_bar::color_hot() { _generation++; return _color_hot; }
 
 		widgets::strength_bar& widgets::strength_bar::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::strength_bar::color_selected() { return _color_selected; }
+		color& widgets::strength_bar::color_selected() { _generation++; return _color_selected; }
 
 		widgets::strength_bar& widgets::strength_bar::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::strength_bar::color_disabled() { return _color_disabled; }
+		color& widgets::strength_bar::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::strength_bar& widgets::strength_bar::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -118,10 +126,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::strength_bar::color_border() { return _color_border; }
+		lecui::color& widgets::strength_bar::color_border() { _generation++; return _color_border; }
 
 		widgets::strength_bar& widgets::strength_bar::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -132,10 +141,11 @@ namespace liblec {
 			return *this;
 		}
 
-		std::vector<widgets::strength_bar::strength_level>& widgets::strength_bar::levels() { return _levels; }
+		std::vector<widgets::strength_bar::strength_level>& widgets::strength_bar::levels() { _generation++; return _levels; }
 
 		widgets::strength_bar& widgets::strength_bar::levels(const std::vector<strength_level>& levels) {
 			_levels = levels;
+			_generation++;
 			return *this;
 		}
 
@@ -230,26 +240,12 @@ namespace liblec {
 
 		widgets::strength_bar&
 			widgets::strength_bar_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_strength_bar_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_strength_bar_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_strength_bar_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -49,7 +49,7 @@ namespace liblec {
 				strength_bar_impl& operator=(const strength_bar_impl&) = delete;
 
 				/// Private variables
-				widgets::strength_bar _specs, _specs_old;
+				widgets::strength_bar _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_border;
 				ID2D1SolidColorBrush* _p_brush_fill;
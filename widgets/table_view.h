@@ -37,7 +37,13 @@ namespace liblec {
 				color _color_row_selected;
 				std::vector<table_column> _columns;
 				std::vector<table_row> _data;
+				lecui::table_data _table_data;
+				bool _columnar = false;
+				unsigned long long _data_generation = 0;
 				std::vector<long> _selected;
+				std::vector<std::pair<long, long>> _selected_ranges;
+				bool _selected_stale = false;
+				unsigned long long _selected_generation = 0;
 				bool _user_sort = false;
 				bool _fixed_number_column = false;
 				std::string _fixed_number_column_name = "#";
@@ -70,6 +76,41 @@ namespace liblec {
 					return _table_events;
 				}
 
+				/// <summary>Virtual data. Lets the table show rows that are kept by the
+				/// application instead of by the table.</summary>
+				struct table_view_virtual_data {
+					/// <summary>The total number of rows.</summary>
+					size_t rows = 0;
+
+					/// <summary>Called to get rows from the application. The first parameter is the
+					/// index of the first row needed and the second is the number of rows needed. The
+					/// rows returned should be in the same form as those given to
+					/// <see cref="data"></see>.</summary>
+					/// <remarks>Only the rows about to be shown are asked for, a block at a time.
+					/// Missing rows are shown as empty rows.</remarks>
+					std::function<std::vector<table_row>(
+						const size_t& first_row, const size_t& count)>
+						fetch = nullptr;
+
+					/// <summary>The number of fetched rows to keep. The least recently shown rows
+					/// are dropped first.</summary>
+					size_t cache_rows = 1024;
+				};
+
+				/// <summary>Get or set the table's virtual data.</summary>
+				/// <returns>A reference to the virtual data.</returns>
+				/// <remarks>The table is in virtual mode while the fetch callback is set; it then
+				/// ignores <see cref="data"></see> and <see cref="columnar_data"></see> and holds
+				/// nothing but the rows it has recently shown. Fetched rows are dropped whenever
+				/// this is called, so call it whenever the application's rows change. User sorting
+				/// is not available in virtual mode.</remarks>
+				table_view_virtual_data& virtual_data();
+
+				/// <summary>Set the table's virtual data.</summary>
+				/// <param name="virtual_data">The virtual data.</param>
+				/// <returns>A reference to the modified object.</returns>
+				table_view& virtual_data(const table_view_virtual_data& virtual_data);
+
 				/// <summary>Check whether widget specs are equal. Only those properties that
 				/// require the widget resources to be re-created are considered.</summary>
 				/// <param name="param">The specs to compare to.</param>
@@ -377,8 +418,29 @@ namespace liblec {
 				/// </example>
 				table_view& data(const std::vector<table_row>& data);
 
+				/// <summary>Get or set the table's data in columnar form. Each column of the data
+				/// is matched to a table column of the same name. Use this instead of
+				/// <see cref="data"></see> for large tables.</summary>
+				/// <returns>A reference to the table's columnar data.</returns>
+				/// <remarks>Once this is called the table shows the columnar data and the data
+				/// set through <see cref="data"></see> is ignored. The rows given by the selection
+				/// and context menu events are made from the columnar data.</remarks>
+				lecui::table_data& columnar_data();
+
+				/// <summary>Set the table's data in columnar form. Each column of the data is
+				/// matched to a table column of the same name. Use this instead of
+				/// <see cref="data"></see> for large tables.</summary>
+				/// <param name="columnar_data">The table's columnar data.</param>
+				/// <returns>A reference to the modified object.</returns>
+				/// <remarks>Once this is called the table shows the columnar data and the data
+				/// set through <see cref="data"></see> is ignored.</remarks>
+				table_view& columnar_data(const lecui::table_data& columnar_data);
+
 				/// <summary>Get or set the rows to select by default, numbered from 0.</summary>
 				/// <returns>A reference to the selected rows.</returns>
+				/// <remarks>The table keeps the selection as ranges of rows. The list is only
+				/// made from them when this is called, so avoid calling it on every frame when
+				/// large blocks of rows may be selected.</remarks>
 				std::vector<long>& selected();
 
 				/// <summary>Set the rows to select by default, numbered from 0.</summary>
@@ -388,6 +450,9 @@ namespace liblec {
 
 				/// <summary>Get or set whether to allow sorting by clicking columns.</summary>
 				/// <returns>A reference to the property.</returns>
+				/// <remarks>Clicking a column with shift pressed adds it to the columns already
+				/// sorted by, so rows that are equal in those columns are ordered by it. Large
+				/// tables are sorted in the background.</remarks>
 				bool& user_sort();
 
 				/// <summary>Set whether to allow sorting by clicking columns.</summary>
@@ -454,8 +519,13 @@ namespace liblec {
 				/// <summary>Table view events.</summary>
 				table_view_events _table_events;
 
+				/// <summary>Table view virtual data.</summary>
+				table_view_virtual_data _virtual_data;
+				unsigned long long _virtual_data_generation = 0;
+
 #if defined(LECUI_EXPORTS)
 				friend class form;
+				friend class table_view_impl;
 #endif
 			};
 		}
@@ -0,0 +1,107 @@
+//
+// row_ranges.cpp - row range set implementation
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#include "row_ranges.h"
+#include <algorithm>
+
+row_ranges::row_ranges(std::vector<range>& ranges) :
+	_ranges(ranges) {}
+
+bool row_ranges::contains(const long& row) const {
+	// the first range that ends at or after the row
+	auto it = std::lower_bound(_ranges.begin(), _ranges.end(), row,
+		[](const range& r, const long& row) { return r.second < row; });
+
+	return it != _ranges.end() && it->first <= row;
+}
+
+bool row_ranges::empty() const {
+	return _ranges.empty();
+}
+
+size_t row_ranges::count() const {
+	size_t count = 0;
+	for (const auto& r : _ranges)
+		count += static_cast<size_t>(r.second - r.first) + 1;
+	return count;
+}
+
+void row_ranges::clear() {
+	_ranges.clear();
+}
+
+void row_ranges::add(long first, long last) {
+	if (first > last)
+		std::swap(first, last);
+
+	// the ranges that overlap or touch [first, last] are merged into it
+	auto begin = std::lower_bound(_ranges.begin(), _ranges.end(), first,
+		[](const range& r, const long& first) { return r.second + 1 < first; });
+
+	auto end = begin;
+	while (end != _ranges.end() && end->first - 1 <= last) {
+		first = std::min(first, end->first);
+		last = std::max(last, end->second);
+		end++;
+	}
+
+	if (begin == end)
+		_ranges.insert(begin, { first, last });
+	else {
+		*begin = { first, last };
+		_ranges.erase(begin + 1, end);
+	}
+}
+
+void row_ranges::remove(const long& row) {
+	auto it = std::lower_bound(_ranges.begin(), _ranges.end(), row,
+		[](const range& r, const long& row) { return r.second < row; });
+
+	if (it == _ranges.end() || it->first > row)
+		return;
+
+	if (it->first == row && it->second == row)
+		_ranges.erase(it);
+	else
+		if (it->first == row)
+			it->first++;
+		else
+			if (it->second == row)
+				it->second--;
+			else {
+				// split the range in two
+				const range after = { row + 1, it->second };
+				it->second = row - 1;
+				_ranges.insert(it + 1, after);
+			}
+}
+
+void row_ranges::assign(const std::vector<long>& rows) {
+	_ranges.clear();
+
+	std::vector<long> sorted(rows);
+	std::sort(sorted.begin(), sorted.end());
+
+	for (const auto& row : sorted) {
+		if (!_ranges.empty() && row <= _ranges.back().second + 1)
+			_ranges.back().second = std::max(_ranges.back().second, row);
+		else
+			_ranges.push_back({ row, row });
+	}
+}
+
+void row_ranges::get(std::vector<long>& rows) const {
+	rows.clear();
+	rows.reserve(count());
+
+	for (const auto& r : _ranges)
+		for (long row = r.first; row <= r.second; row++)
+			rows.push_back(row);
+}
@@ -0,0 +1,54 @@
+//
+// row_ranges.h - row range set interface
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+/// <summary>A set of rows kept as a sorted list of [first, last] ranges.</summary>
+/// <remarks>The ranges never overlap or touch, so a contiguous block of rows, however large,
+/// takes a single entry. Checking whether a row is in the set takes logarithmic time in the
+/// number of ranges. The list itself belongs to the caller; this class only operates on it.
+/// </remarks>
+class row_ranges {
+public:
+	using range = std::pair<long, long>;
+
+	row_ranges(std::vector<range>& ranges);
+
+	/// <summary>Check whether a row is in the set.</summary>
+	bool contains(const long& row) const;
+
+	/// <summary>Check whether the set is empty.</summary>
+	bool empty() const;
+
+	/// <summary>Get the number of rows in the set.</summary>
+	size_t count() const;
+
+	/// <summary>Remove all the rows.</summary>
+	void clear();
+
+	/// <summary>Add the rows from first to last inclusive.</summary>
+	void add(long first, long last);
+
+	/// <summary>Remove a row.</summary>
+	void remove(const long& row);
+
+	/// <summary>Replace the set with a list of rows, in any order.</summary>
+	void assign(const std::vector<long>& rows);
+
+	/// <summary>Write the rows in the set to a list, in ascending order.</summary>
+	void get(std::vector<long>& rows) const;
+
+private:
+	std::vector<range>& _ranges;
+};
@@ -0,0 +1,702 @@
+//
+// table_data.cpp - columnar table data implementation
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#include "../../form_common.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cwchar>
+#include <deque>
+#include <execution>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace liblec {
+	namespace lecui {
+		constexpr int table_data_text_precision = 2;	// for the text of real numbers under a text column
+
+		class table_data::impl {
+		public:
+			struct column {
+				std::string name;
+				column_type type = column_type::text;
+				std::vector<long long> integers;
+				std::vector<double> reals;
+				std::vector<unsigned long> texts;	// indices into the string pool
+				std::vector<bool> empty;
+
+				// numbers that were assigned to a text column, by row, so that they are still
+				// given and shown as numbers; their text is also in texts
+				std::unordered_map<size_t, long long> integer_cells;
+				std::unordered_map<size_t, double> real_cells;
+			};
+
+			std::vector<column> _columns;
+			std::unordered_map<std::string, size_t> _column_index;
+			size_t _rows = 0;
+
+			// string pool; entry 0 is the blank string used for empty text cells
+			std::deque<std::string> _strings;
+			std::unordered_map<std::string_view, unsigned long> _string_index;
+			std::vector<unsigned long> _string_refs;	// the number of cells using each string
+			std::vector<unsigned long> _free_strings;	// slots of strings that no cell uses anymore
+			mutable std::vector<std::wstring> _wide_strings;	// converted on first display
+			mutable std::vector<bool> _wide_converted;
+			mutable std::wstring _buffer;
+
+			impl() { clear(); }
+
+			impl(const impl& right) { *this = right; }
+
+			impl& operator=(const impl& right) {
+				if (this == &right)
+					return *this;
+
+				_columns = right._columns;
+				_column_index = right._column_index;
+				_rows = right._rows;
+
+				// the pool's keys point into the strings, so they have to be rebuilt
+				_strings = right._strings;
+				_string_refs = right._string_refs;
+				_free_strings = right._free_strings;
+				_string_index.clear();
+				for (unsigned long i = 0; i < _strings.size(); i++)
+					if (i == 0 || _string_refs[i] > 0)
+						_string_index.emplace(_strings[i], i);
+
+				_wide_strings = right._wide_strings;
+				_wide_converted = right._wide_converted;
+				return *this;
+			}
+
+			void clear() {
+				_columns.clear();
+				_column_index.clear();
+				_rows = 0;
+				_strings.clear();
+				_string_index.clear();
+				_string_refs.clear();
+				_free_strings.clear();
+				_wide_strings.clear();
+				_wide_converted.clear();
+				intern(std::string());
+			}
+
+			/// add a reference to a string, adding it to the pool if it isn't there
+			unsigned long intern(const std::string& text) {
+				auto it = _string_index.find(text);
+				if (it != _string_index.end()) {
+					_string_refs[it->second]++;
+					return it->second;
+				}
+
+				unsigned long index = 0;
+
+				if (!_free_strings.empty()) {
+					// reuse the slot of a string that is no longer used
+					index = _free_strings.back();
+					_free_strings.pop_back();
+					_strings[index] = text;
+					_string_refs[index] = 1;
+				}
+				else {
+					index = static_cast<unsigned long>(_strings.size());
+					_strings.push_back(text);
+					_string_refs.push_back(1);
+					_wide_strings.emplace_back();
+					_wide_converted.push_back(false);
+				}
+
+				_string_index.emplace(_strings[index], index);
+				return index;
+			}
+
+			/// drop a reference to a string, freeing its slot once no cell uses it
+			void release(const unsigned long& index) {
+				if (index == 0 || --_string_refs[index] > 0)
+					return;	// the blank string is never freed
+
+				_string_index.erase(_strings[index]);
+				std::string().swap(_strings[index]);
+				std::wstring().swap(_wide_strings[index]);
+				_wide_converted[index] = false;
+				_free_strings.push_back(index);
+			}
+
+			/// empty a text cell, or the text cell of a number in a text column
+			void clear_text(column& col, const size_t& row) {
+				release(col.texts[row]);
+				col.texts[row] = 0;
+
+				if (!col.integer_cells.empty())
+					col.integer_cells.erase(row);
+
+				if (!col.real_cells.empty())
+					col.real_cells.erase(row);
+			}
+
+			void text_integer(column& col, const size_t& row, const long long& value) {
+				clear_text(col, row);
+				col.texts[row] = intern(std::to_string(value));
+				col.integer_cells[row] = value;
+			}
+
+			void text_real(column& col, const size_t& row, const double& value) {
+				clear_text(col, row);
+				col.texts[row] = intern(round_off::to_string(value, table_data_text_precision));
+				col.real_cells[row] = value;
+			}
+
+			/// widen an integer column to a real one
+			void to_real(column& col) {
+				col.reals.resize(_rows, 0.0);
+				for (size_t row = 0; row < _rows; row++)
+					col.reals[row] = static_cast<double>(col.integers[row]);
+
+				std::vector<long long>().swap(col.integers);
+				col.type = table_data::column_type::real;
+			}
+
+			/// make a column a text column, keeping the numbers already in it
+			void to_text(column& col) {
+				const auto type = col.type;
+				col.type = table_data::column_type::text;
+				col.texts.assign(_rows, 0);
+
+				for (size_t row = 0; row < _rows; row++) {
+					if (col.empty[row])
+						continue;
+
+					if (type == table_data::column_type::integer)
+						text_integer(col, row, col.integers[row]);
+					else
+						text_real(col, row, col.reals[row]);
+				}
+
+				std::vector<long long>().swap(col.integers);
+				std::vector<double>().swap(col.reals);
+			}
+
+			const std::wstring& format_real(const double& value, const int& precision) const {
+				wchar_t buffer[64];
+
+				// same result as round_off::to_string, which uses std::fixed
+				const int length = swprintf(buffer, sizeof(buffer) / sizeof(buffer[0]), L"%.*f", precision, value);
+
+				if (length < 0)
+					// too long for the buffer
+					_buffer = convert_string(round_off::to_string(value, precision));
+				else
+					_buffer.assign(buffer, static_cast<size_t>(length));
+
+				return _buffer;
+			}
+
+			column& get_column(const size_t& column, const column_type& type) {
+				auto& col = _columns.at(column);
+				if (col.type != type)
+					throw std::invalid_argument("Column '" + col.name + "' is of a different type");
+				return col;
+			}
+
+			const column& get_column(const size_t& column, const column_type& type) const {
+				const auto& col = _columns.at(column);
+				if (col.type != type)
+					throw std::invalid_argument("Column '" + col.name + "' is of a different type");
+				return col;
+			}
+
+			void check_row(const size_t& row) const {
+				if (row >= _rows)
+					throw std::out_of_range("Row " + std::to_string(row) + " does not exist");
+			}
+
+			void resize(column& col, const size_t& rows) {
+				switch (col.type) {
+				case column_type::integer: col.integers.resize(rows, 0); break;
+				case column_type::real: col.reals.resize(rows, 0.0); break;
+				case column_type::text:
+				default: col.texts.resize(rows, 0); break;
+				}
+				col.empty.resize(rows, true);
+			}
+		};
+
+		table_data::table_data() :
+			_d(*(new impl())) {}
+
+		table_data::table_data(const table_data& right) :
+			_d(*(new impl(right._d))) {}
+
+		table_data& table_data::operator=(const table_data& right) {
+			_d = right._d;
+			return *this;
+		}
+
+		table_data::~table_data() { delete& _d; }
+
+		void table_data::clear() { _d.clear(); }
+
+		size_t table_data::add_column(const std::string& name, const column_type& type) {
+			auto it = _d._column_index.find(name);
+			if (it != _d._column_index.end())
+				return it->second;
+
+			impl::column col;
+			col.name = name;
+			col.type = type;
+			_d.resize(col, _d._rows);
+
+			_d._columns.push_back(std::move(col));
+			_d._column_index.emplace(name, _d._columns.size() - 1);
+			return _d._columns.size() - 1;
+		}
+
+		size_t table_data::columns() const { return _d._columns.size(); }
+
+		long table_data::find_column(const std::string& name) const {
+			auto it = _d._column_index.find(name);
+			return it == _d._column_index.end() ? -1L : static_cast<long>(it->second);
+		}
+
+		const std::string& table_data::column_name(const size_t& column) const {
+			return _d._columns.at(column).name;
+		}
+
+		table_data::column_type table_data::type(const size_t& column) const {
+			return _d._columns.at(column).type;
+		}
+
+		size_t table_data::rows() const { return _d._rows; }
+
+		void table_data::reserve(const size_t& rows) {
+			for (auto& col : _d._columns) {
+				switch (col.type) {
+				case column_type::integer: col.integers.reserve(rows); break;
+				case column_type::real: col.reals.reserve(rows); break;
+				case column_type::text:
+				default: col.texts.reserve(rows); break;
+				}
+				col.empty.reserve(rows);
+			}
+		}
+
+		size_t table_data::add_row() {
+			for (auto& col : _d._columns) {
+				switch (col.type) {
+				case column_type::integer: col.integers.push_back(0); break;
+				case column_type::real: col.reals.push_back(0.0); break;
+				case column_type::text:
+				default: col.texts.push_back(0); break;
+				}
+				col.empty.push_back(true);
+			}
+
+			return _d._rows++;
+		}
+
+		bool table_data::empty(const size_t& row, const size_t& column) const {
+			_d.check_row(row);
+			return _d._columns.at(column).empty[row];
+		}
+
+		table_data& table_data::clear(const size_t& row, const size_t& column) {
+			_d.check_row(row);
+			auto& col = _d._columns.at(column);
+
+			switch (col.type) {
+			case column_type::integer: col.integers[row] = 0; break;
+			case column_type::real: col.reals[row] = 0.0; break;
+			case column_type::text:
+			default: _d.clear_text(col, row); break;
+			}
+
+			col.empty[row] = true;
+			return *this;
+		}
+
+		long long table_data::integer(const size_t& row, const size_t& column) const {
+			_d.check_row(row);
+			return _d.get_column(column, column_type::integer).integers[row];
+		}
+
+		table_data& table_data::integer(const size_t& row, const size_t& column, const long long& value) {
+			_d.check_row(row);
+			auto& col = _d.get_column(column, column_type::integer);
+			col.integers[row] = value;
+			col.empty[row] = false;
+			return *this;
+		}
+
+		double table_data::real(const size_t& row, const size_t& column) const {
+			_d.check_row(row);
+			return _d.get_column(column, column_type::real).reals[row];
+		}
+
+		table_data& table_data::real(const size_t& row, const size_t& column, const double& value) {
+			_d.check_row(row);
+			auto& col = _d.get_column(column, column_type::real);
+			col.reals[row] = value;
+			col.empty[row] = false;
+			return *this;
+		}
+
+		const std::string& table_data::text(const size_t& row, const size_t& column) const {
+			_d.check_row(row);
+			return _d._strings[_d.get_column(column, column_type::text).texts[row]];
+		}
+
+		table_data& table_data::text(const size_t& row, const size_t& column, const std::string& value) {
+			_d.check_row(row);
+			auto& col = _d.get_column(column, column_type::text);
+			const auto index = _d.intern(value);	// before the old text is released, in case it's the same
+			_d.clear_text(col, row);
+			col.texts[row] = index;
+			col.empty[row] = false;
+			return *this;
+		}
+
+		table_row table_data::row(const size_t& row) const {
+			_d.check_row(row);
+
+			table_row values;
+			for (const auto& col : _d._columns) {
+				if (col.empty[row])
+					continue;
+
+				switch (col.type) {
+				case column_type::integer:
+					values.emplace(col.name, col.integers[row]);
+					break;
+				case column_type::real:
+					values.emplace(col.name, col.reals[row]);
+					break;
+				case column_type::text:
+				default: {
+					// numbers under a text column are given back as numbers
+					const auto it_integer = col.integer_cells.find(row);
+					if (it_integer != col.integer_cells.end()) {
+						values.emplace(col.name, it_integer->second);
+						break;
+					}
+
+					const auto it_real = col.real_cells.find(row);
+					if (it_real != col.real_cells.end()) {
+						values.emplace(col.name, it_real->second);
+						break;
+					}
+
+					values.emplace(col.name, _d._strings[col.texts[row]]);
+				} break;
+				}
+			}
+
+			return values;
+		}
+
+		void table_data::assign(const std::vector<table_row>& data) {
+			_d.clear();
+
+			for (const auto& it : data) {
+				const size_t row = add_row();
+
+				for (const auto& [name, value] : it) {
+					if (!value.has_value())
+						continue;
+
+					const auto& value_type = value.type();
+					const bool is_integer = value_type == typeid(int) || value_type == typeid(long long);
+					const bool is_real = value_type == typeid(float) || value_type == typeid(double);
+					const bool is_text = value_type == typeid(const char*) || value_type == typeid(std::string);
+
+					auto it_column = _d._column_index.find(name);
+					size_t column = 0;
+
+					if (it_column != _d._column_index.end())
+						column = it_column->second;
+					else {
+						if (is_integer)
+							column = add_column(name, column_type::integer);
+						else
+							if (is_real)
+								column = add_column(name, column_type::real);
+							else
+								if (is_text)
+									column = add_column(name, column_type::text);
+								else
+									continue;	// unsupported type
+					}
+
+					if (!is_integer && !is_real && !is_text)
+						continue;	// unsupported type
+
+					auto& col = _d._columns[column];
+
+					// a real number widens an integer column, and any other mix of types is kept
+					// as text, so that every cell is still shown
+					if (col.type == column_type::integer && is_real)
+						_d.to_real(col);
+					else
+						if (col.type != column_type::text && is_text)
+							_d.to_text(col);
+
+					auto integer_value = [&]() {
+						return value_type == typeid(int) ?
+							static_cast<long long>(std::any_cast<int>(value)) : std::any_cast<long long>(value);
+					};
+
+					switch (col.type) {
+					case column_type::integer:
+						col.integers[row] = integer_value();
+						break;
+
+					case column_type::real:
+						col.reals[row] = is_real ? get::real(value) : static_cast<double>(integer_value());
+						break;
+
+					case column_type::text:
+					default:
+						if (is_text)
+							col.texts[row] = _d.intern(get::text(value));
+						else
+							if (is_integer)
+								_d.text_integer(col, row, integer_value());
+							else
+								_d.text_real(col, row, get::real(value));
+						break;
+					}
+
+					col.empty[row] = false;
+				}
+			}
+		}
+
+		const std::wstring& table_data::display_text(const size_t& row, const size_t& column,
+			const int& precision) const {
+			_d.check_row(row);
+			const auto& col = _d._columns.at(column);
+
+			if (col.empty[row]) {
+				_d._buffer.clear();
+				return _d._buffer;
+			}
+
+			wchar_t buffer[64];
+			int length = 0;
+
+			switch (col.type) {
+			case column_type::integer:
+				length = swprintf(buffer, sizeof(buffer) / sizeof(buffer[0]), L"%lld", col.integers[row]);
+				break;
+
+			case column_type::real:
+				return _d.format_real(col.reals[row], precision);
+
+			case column_type::text:
+			default: {
+				if (!col.real_cells.empty()) {
+					// real numbers under a text column are shown to the column's precision
+					const auto it = col.real_cells.find(row);
+					if (it != col.real_cells.end())
+						return _d.format_real(it->second, precision);
+				}
+
+				const auto index = col.texts[row];
+
+				if (!_d._wide_converted[index]) {
+					_d._wide_strings[index] = convert_string(_d._strings[index]);
+					_d._wide_converted[index] = true;
+				}
+
+				return _d._wide_strings[index];
+			}
+			}
+
+			_d._buffer.assign(buffer, length > 0 ? static_cast<size_t>(length) : 0);
+			return _d._buffer;
+		}
+
+		void table_data::sort_keys(const std::vector<sort_column>& columns,
+			std::vector<unsigned long long>& keys, std::vector<text_keys>& texts) const {
+			const auto rows = _d._rows;
+			keys.resize(columns.size() * rows);
+			texts.clear();
+
+			// keys of non-empty cells are never 0, so that empty cells sort first in ascending
+			// order; in descending order the keys are inverted and empty cells are given the largest key
+			constexpr unsigned long long sign = 1ULL << 63;
+
+			for (size_t i = 0; i < columns.size(); i++) {
+				const auto& col = _d._columns.at(columns[i].column);
+				const bool ascending = columns[i].ascending;
+				auto* p_keys = keys.data() + i * rows;
+
+				auto extract = [&](auto key) {
+					for (size_t row = 0; row < rows; row++) {
+						if (col.empty[row])
+							p_keys[row] = ascending ? 0ULL : ~0ULL;
+						else {
+							const unsigned long long value = std::max(key(row), 1ULL);
+							p_keys[row] = ascending ? value : ~value;
+						}
+					}
+				};
+
+				switch (col.type) {
+				case column_type::integer:
+					extract([&](const size_t& row) {
+						return static_cast<unsigned long long>(col.integers[row]) ^ sign;
+						});
+					break;
+
+				case column_type::real:
+					extract([&](const size_t& row) {
+						// order the bits of the double as unsigned integers
+						unsigned long long bits = 0;
+						std::memcpy(&bits, &col.reals[row], sizeof(bits));
+						return (bits & sign) ? ~bits : bits | sign;
+						});
+					break;
+
+				case column_type::text:
+				default: {
+					// copy the strings the column uses and key the rows by their position in the
+					// copy, for rank_text to replace with the rank of the string
+					text_keys text;
+					text.block = i;
+					text.ascending = ascending;
+
+					std::vector<unsigned long> position(_d._strings.size(), 0UL);
+
+					for (size_t row = 0; row < rows; row++) {
+						if (col.empty[row]) {
+							p_keys[row] = ascending ? 0ULL : ~0ULL;
+							continue;
+						}
+
+						auto& n = position[col.texts[row]];
+
+						if (n == 0) {
+							text.strings.push_back(_d._strings[col.texts[row]]);
+							n = static_cast<unsigned long>(text.strings.size());
+						}
+
+						p_keys[row] = n;
+					}
+
+					texts.push_back(std::move(text));
+				} break;
+				}
+			}
+		}
+
+		void table_data::rank_text(const std::vector<text_keys>& texts, const size_t& rows,
+			std::vector<unsigned long long>& keys) {
+			for (const auto& text : texts) {
+				// rank the distinct strings once so that rows are compared as integers
+				std::vector<unsigned long> by_text(text.strings.size());
+				std::iota(by_text.begin(), by_text.end(), 0UL);
+				std::sort(by_text.begin(), by_text.end(), [&](const unsigned long& a, const unsigned long& b) {
+					return text.strings[a] < text.strings[b];
+					});
+
+				std::vector<unsigned long long> rank(by_text.size());
+				for (unsigned long n = 0; n < by_text.size(); n++)
+					rank[by_text[n]] = n + 1ULL;
+
+				auto* p_keys = keys.data() + text.block * rows;
+
+				for (size_t row = 0; row < rows; row++) {
+					// empty cells already have their final keys
+					if (p_keys[row] == 0ULL || p_keys[row] == ~0ULL)
+						continue;
+
+					const auto value = rank[p_keys[row] - 1];
+					p_keys[row] = text.ascending ? value : ~value;
+				}
+			}
+		}
+
+		void table_data::sort_order(const std::vector<unsigned long long>& keys, const size_t& rows,
+			std::vector<size_t>& order) {
+			order.resize(rows);
+			std::iota(order.begin(), order.end(), size_t(0));
+
+			if (rows == 0)
+				return;
+
+			// sort by the least significant column first; since every pass is stable the rows end
+			// up ordered by all the columns, and each pass works on a contiguous array of pairs
+			struct entry {
+				unsigned long long key;
+				size_t row;
+			};
+
+			std::vector<entry> entries(rows);
+
+			for (size_t i = keys.size() / rows; i-- > 0;) {
+				const auto* p_keys = keys.data() + i * rows;
+
+				for (size_t j = 0; j < rows; j++)
+					entries[j] = { p_keys[order[j]], order[j] };
+
+				std::stable_sort(std::execution::par, entries.begin(), entries.end(),
+					[](const entry& a, const entry& b) { return a.key < b.key; });
+
+				for (size_t j = 0; j < rows; j++)
+					order[j] = entries[j].row;
+			}
+		}
+
+		void table_data::reorder(const std::vector<size_t>& order) {
+			if (order.size() != _d._rows)
+				throw std::invalid_argument("The order doesn't cover every row");
+
+			auto gather = [&](auto& values) {
+				auto reordered = values;
+				for (size_t i = 0; i < order.size(); i++)
+					reordered[i] = values[order[i]];
+				values.swap(reordered);
+			};
+
+			auto gather_cells = [&](auto& cells) {
+				if (cells.empty())
+					return;
+
+				std::remove_reference_t<decltype(cells)> reordered;
+				for (size_t i = 0; i < order.size(); i++) {
+					const auto it = cells.find(order[i]);
+					if (it != cells.end())
+						reordered.emplace(i, it->second);
+				}
+				cells.swap(reordered);
+			};
+
+			for (auto& col : _d._columns) {
+				switch (col.type) {
+				case column_type::integer: gather(col.integers); break;
+				case column_type::real: gather(col.reals); break;
+				case column_type::text:
+				default:
+					gather(col.texts);
+					gather_cells(col.integer_cells);
+					gather_cells(col.real_cells);
+					break;
+				}
+
+				gather(col.empty);
+			}
+		}
+	}
+}
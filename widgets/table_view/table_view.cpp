@@ -10,6 +10,7 @@
 
 #include "../table_view.h"
 #include "../../form_impl/form_impl.h"
+#include "row_ranges.h"
 
 namespace liblec {
 	namespace lecui {
@@ -51,6 +52,10 @@ namespace liblec {
 			// events
 			_table_events = right._table_events;
 
+			// virtual data
+			_virtual_data = right._virtual_data;
+			_virtual_data_generation = right._virtual_data_generation;
+
 			// widget specific widget
 			_border = right._border;
 			_grid_line = right._grid_line;
@@ -67,7 +72,13 @@ namespace liblec {
 			_color_row_selected = right._color_row_selected;
 			_columns = right._columns;
 			_data = right._data;
+			_table_data = right._table_data;
+			_columnar = right._columnar;
+			_data_generation = right._data_generation;
 			_selected = right._selected;
+			_selected_ranges = right._selected_ranges;
+			_selected_stale = right._selected_stale;
+			_selected_generation = right._selected_generation;
 			_user_sort = right._user_sort;
 			_fixed_number_column = right._fixed_number_column;
 			_fixed_number_column_name = right._fixed_number_column_name;
@@ -127,35 +138,41 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::table_view::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::table_view::cursor() { _generation++; return _cursor; }
 
 		widgets::table_view& widgets::table_view::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::table_view::font() { return _font; }
+		std::string& widgets::table_view::font() { _generation++; return _font; }
 
 		widgets::table_view& widgets::table_view::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::table_view::font_size() { return _font_size; }
+		float& widgets::table_view::font_size() { _generation++; return _font_size; }
 
 		widgets::table_view& widgets::table_view::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::table_view::color_text() { return _color_text; }
+		color& widgets::table_view::color_text() { _generation++; return _color_text; }
 
 		widgets::table_view& widgets::table_view::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
 		color& widgets::table_view::color_fill() {
+			_generation++;
+
 			if (_p_special_pane)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane*>(_p_special_pane)->color_fill();
 			else
@@ -168,27 +185,31 @@ namespace liblec {
 			else
 				_color_fill = color_fill;
 
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::table_view::color_hot() { return _color_hot; }
+		color& widgets::table_view::color_hot() { _generation++; return _color_hot; }
 
 		widgets::table_view& widgets::table_view::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::table_view::color_selected() { return _color_selected; }
+		color& widgets::table_view::color_selected() { _generation++; return _color_selected; }
 
 		widgets::table_view& widgets::table_view::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::table_view::color_disabled() { return _color_disabled; }
+		color& widgets::table_view::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::table_view& widgets::table_view::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -216,6 +237,8 @@ namespace liblec {
 		}
 
 		lecui::color& widgets::table_view::color_border() {
+			_generation++;
+
 			if (_p_special_pane)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane*>(_p_special_pane)->color_border();
 			else
@@ -228,6 +251,7 @@ namespace liblec {
 			else
 				_color_border = color_border;
 
+			_generation++;
 			return *this;
 		}
 
@@ -252,52 +276,59 @@ namespace liblec {
 			return *this;
 		}
 
-		color& widgets::table_view::color_grid() { return _color_grid; }
+		color& widgets::table_view::color_grid() { _generation++; return _color_grid; }
 
 		widgets::table_view& widgets::table_view::color_grid(const color& color_grid) {
 			_color_grid = color_grid;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::table_view::color_text_header() { return _color_text_header; }
+		lecui::color& widgets::table_view::color_text_header() { _generation++; return _color_text_header; }
 
 		widgets::table_view& widgets::table_view::color_text_header(const color& color_text_header) {
 			_color_text_header = color_text_header;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::table_view::color_text_header_hot() { return _color_text_header_hot; }
+		lecui::color& widgets::table_view::color_text_header_hot() { _generation++; return _color_text_header_hot; }
 
 		widgets::table_view& widgets::table_view::color_text_header_hot(const color& color_text_header_hot) {
 			_color_text_header_hot = color_text_header_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::table_view::color_fill_header() { return _color_fill_header; }
+		color& widgets::table_view::color_fill_header() { _generation++; return _color_fill_header; }
 
 		widgets::table_view& widgets::table_view::color_fill_header(const color& color_fill_header) {
 			_color_fill_header = color_fill_header;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::table_view::color_fill_alternate() { return _color_fill_alternate; }
+		lecui::color& widgets::table_view::color_fill_alternate() { _generation++; return _color_fill_alternate; }
 
 		widgets::table_view& widgets::table_view::color_fill_alternate(const color& color_fill_alternate) {
 			_color_fill_alternate = color_fill_alternate;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::table_view::color_row_hot() { return _color_row_hot; }
+		lecui::color& widgets::table_view::color_row_hot() { _generation++; return _color_row_hot; }
 
 		widgets::table_view& widgets::table_view::color_row_hot(const color& color_row_hot) {
 			_color_row_hot = color_row_hot;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::table_view::color_row_selected() { return _color_row_selected; }
+		lecui::color& widgets::table_view::color_row_selected() { _generation++; return _color_row_selected; }
 
 		widgets::table_view& widgets::table_view::color_row_selected(const color& color_row_selected) {
 			_color_row_selected = color_row_selected;
+			_generation++;
 			return *this;
 		}
 
@@ -308,17 +339,53 @@ namespace liblec {
 			return *this;
 		}
 
-		std::vector<table_row>& widgets::table_view::data() { return _data; }
+		std::vector<table_row>& widgets::table_view::data() { _data_generation++; return _data; }
 
 		widgets::table_view& widgets::table_view::data(const std::vector<table_row>& data) {
 			_data = data;
+			_data_generation++;
+			return *this;
+		}
+
+		lecui::table_data& widgets::table_view::columnar_data() {
+			_columnar = true;
+			_data_generation++;
+			return _table_data;
+		}
+
+		widgets::table_view& widgets::table_view::columnar_data(const lecui::table_data& columnar_data) {
+			_table_data = columnar_data;
+			_columnar = true;
+			_data_generation++;
 			return *this;
 		}
 
-		std::vector<long>& widgets::table_view::selected() { return _selected; }
+		widgets::table_view::table_view_virtual_data& widgets::table_view::virtual_data() {
+			_virtual_data_generation++;
+			return _virtual_data;
+		}
+
+		widgets::table_view& widgets::table_view::virtual_data(const table_view_virtual_data& virtual_data) {
+			_virtual_data = virtual_data;
+			_virtual_data_generation++;
+			return *this;
+		}
+
+		std::vector<long>& widgets::table_view::selected() {
+			if (_selected_stale) {
+				// the selection has changed in the table since the list was last made
+				row_ranges(_selected_ranges).get(_selected);
+				_selected_stale = false;
+			}
+
+			_selected_generation++;
+			return _selected;
+		}
 
 		widgets::table_view& widgets::table_view::selected(const std::vector<long>& selected) {
 			_selected = selected;
+			_selected_stale = false;
+			_selected_generation++;
 			return *this;
 		}
 
@@ -433,26 +500,12 @@ namespace liblec {
 
 		widgets::table_view&
 			widgets::table_view_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_table_view_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_table_view_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_table_view_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
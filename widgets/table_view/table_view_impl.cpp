@@ -10,10 +10,19 @@
 
 #include "table_view_impl.h"
 #include "../../containers/page/page_impl.h"
+#include "../../utilities/timer.h"
 #include <algorithm>
+#include <string_view>
+#include <chrono>
+
+#define LAYOUTCOUNT	0	// set to 1 to log the number of text layouts created in every frame, 0 otherwise
+#define SELECTIONTIME	0	// set to 1 to log the time spent checking the selection in every frame, 0 otherwise
 
 namespace liblec {
 	namespace lecui {
+		constexpr size_t cache_block_rows = 64;	// rows fetched at a time in virtual mode
+		constexpr size_t async_sort_rows = 100000;	// tables this large are sorted on another thread
+
 		widgets::table_view_impl::table_view_impl(containers::page& page,
 			const std::string& alias,
 			IDWriteFactory* p_directwrite_factory) :
@@ -34,16 +43,30 @@ namespace liblec {
 			_p_brush_row_selected(nullptr),
 			_p_text_format(nullptr),
 			_p_directwrite_factory(p_directwrite_factory),
-			_p_text_layout(nullptr),
 			_rectA({ 0, 0, 0, 0 }),
 			_rectB({ 0, 0, 0, 0 }),
 			_row_height(20.f),
 			_margin(_row_height / 4.f),
 			_rect_header({ 0.f, 0.f, 0.f, 0.f }),
+			_rect_rows({ 0.f, 0.f, 0.f, 0.f }),
 			_last_selected(0UL),
-			_book_on_selection(false) {}
-
-		widgets::table_view_impl::~table_view_impl() { discard_resources(); }
+			_book_on_selection(false),
+			_data_generation(0),
+			_selected_generation(0),
+			_sort_data_generation(0),
+			_sort_timer_name("sort_timer::table_view::" + alias),
+			_cache_min_blocks(2),
+			_virtual_data_generation(0),
+			_frame(0),
+			_layouts_created(0),
+			_layouts_reused(0) {}
+
+		widgets::table_view_impl::~table_view_impl() {
+			if (_sort_result.valid())
+				timer_manager(get_form()).stop(_sort_timer_name);
+
+			discard_resources();
+		}
 
 		widgets::widget_type
 			widgets::table_view_impl::type() {
@@ -52,7 +75,6 @@ namespace liblec {
 
 		HRESULT widgets::table_view_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = false;
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -139,20 +161,32 @@ namespace liblec {
 			safe_release(&_p_brush_border);
 			safe_release(&_p_brush_grid);
 			safe_release(&_p_text_format);
+			release_layouts();
 		}
 
 		D2D1_RECT_F&
 			widgets::table_view_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
+			sync_data();
+
+			if (render && _visible) {
+				// start a new frame; the text layouts used in it are marked with its number
+				_frame++;
+				_layouts_created = 0;
+				_layouts_reused = 0;
+			}
+
 			// check if user requested a fixed numbered column
 			if (_specs.fixed_number_column()) {
 				// failsafe
@@ -232,7 +266,7 @@ namespace liblec {
 
 			float table_width = 0.f;
 			for (const auto& it : _specs.columns()) table_width += static_cast<float>(it.width);
-			float table_height = _row_height * _specs.data().size();
+			float table_height = _row_height * row_count();
 
 			// adjust _rect (what will be written back) to match the table's used area
 			_rect.bottom = _rectA.top + table_height;
@@ -246,13 +280,15 @@ namespace liblec {
 				rect_header_cell.left = _rectA.left;
 				rect_header_cell.right = rect_header_cell.left;
 
-				for (const auto& it : _specs.columns()) {
+				for (size_t column = 0; column < _specs.columns().size(); column++) {
+					const auto& it = _specs.columns()[column];
 					rect_header_cell.left = rect_header_cell.right;
 					rect_header_cell.right = rect_header_cell.left + static_cast<float>(it.width);
 
 					bool hot = false;
 
-					if (specs().user_sort() && !(specs().fixed_number_column() && it.name == _specs.fixed_number_column_name())) {
+					if (specs().user_sort() && !virtual_mode() &&
+						!(specs().fixed_number_column() && it.name == _specs.fixed_number_column_name())) {
 						// check if mouse is within this cell
 						auto rect = rect_header_cell;
 
@@ -348,23 +384,15 @@ namespace liblec {
 					rect_text.left += _margin;
 					rect_text.right -= _margin;
 
-					auto hr = _p_directwrite_factory->CreateTextLayout(
-						convert_string(it.name).c_str(),
-						(UINT32)it.name.length(),
-						_p_text_format,
-						rect_text.right - rect_text.left,
-						rect_text.bottom - rect_text.top,
-						&_p_text_layout);
-
-					DWRITE_TEXT_RANGE text_range = { 0, static_cast<UINT32>(it.name.length()) };
-
-					_p_text_layout->SetFontWeight(DWRITE_FONT_WEIGHT_BOLD, text_range);
-
-					if (SUCCEEDED(hr) && render && _visible)
-						p_render_target->DrawTextLayout(D2D1_POINT_2F{ rect_text.left, rect_text.top },
-							_p_text_layout, hot ? _p_brush_text_header_hot : _p_brush_text_header, D2D1_DRAW_TEXT_OPTIONS_CLIP);
+					if (render && _visible) {
+						const auto name = convert_string(it.name);
+						auto p_text_layout = text_layout(_header_layouts[column],
+							name.c_str(), static_cast<UINT32>(name.length()), rect_text, true);
 
-					safe_release(&_p_text_layout);
+						if (p_text_layout)
+							p_render_target->DrawTextLayout(D2D1_POINT_2F{ rect_text.left, rect_text.top },
+								p_text_layout, hot ? _p_brush_text_header_hot : _p_brush_text_header, D2D1_DRAW_TEXT_OPTIONS_CLIP);
+					}
 				}
 			}
 
@@ -375,13 +403,14 @@ namespace liblec {
 
 			// step11: draw table
 			{
-				_hot_spots.clear();
-
 				// step11a: clip to table area
 				auto rect_clip = _rectB;
 				rect_clip.top = _rect_header.bottom;
 				auto_clip clip(render, p_render_target, rect_clip, 0.f);
 
+				// rows can only be clicked where they can be seen
+				_rect_rows = rect_clip;
+
 				// step11b: figure out which rows are hidden from view and exclude them from the rendering
 				// this gives a major performance boost when dealing with very large tables
 				unsigned long hidden_above = (_rectB.top > _rectA.top) ?
@@ -391,36 +420,65 @@ namespace liblec {
 
 				// step11c: do the drawing
 				{
+					// match the columns by name once rather than in every cell
+					auto map_columns = [&](const lecui::table_data& rows) {
+						_column_index.clear();
+						for (const auto& it : _specs.columns())
+							_column_index.push_back(rows.find_column(it.name));
+					};
+
+					// in virtual mode the rows come from the cache, a block at a time
+					const lecui::table_data* p_rows = nullptr;
+
+					if (virtual_mode()) {
+						// keep enough blocks for all the visible rows
+						const size_t visible_rows = static_cast<size_t>((_rectB.bottom - _rectB.top) / _row_height) + 1;
+						_cache_min_blocks = visible_rows / cache_block_rows + 2;
+					}
+					else {
+						p_rows = &_specs._table_data;
+						map_columns(*p_rows);
+					}
+
+					const auto selected_rows = selection();
+
+#if SELECTIONTIME
+					std::chrono::steady_clock::duration selection_time{};
+#endif
+
+					// the row under the mouse
+					unsigned long hot_row = 0;
+					const bool row_hot = _hit && row_at(_point, hot_row);
+
 					auto rect_row = _rectA;
 					rect_row.bottom = rect_row.top + _row_height * (hidden_above);
 
 					for (unsigned long row_number = hidden_above;
-						row_number < (_specs.data().size() - hidden_below); row_number++) {
+						row_number < (row_count() - hidden_below); row_number++) {
 						rect_row.top = rect_row.bottom;
 						rect_row.bottom = rect_row.top + _row_height;
 
-						bool selected = std::find(_specs.selected().begin(), _specs.selected().end(),
-							row_number) != _specs.selected().end();
-						bool hot = false;
-
-						{
-							auto rect = rect_row;
-							rect.left = _rectB.left;
-							rect.right = _rectB.right;
+						size_t data_row = row_number;
 
-							_hot_spots[row_number] = rect;
+						if (virtual_mode()) {
+							const auto& rows = cached_rows(row_number, data_row);
 
-							scale_RECT(rect, get_dpi_scale());
+							// blocks are drawn in order, so a new block starts at its first row
+							if (p_rows == nullptr || data_row == 0)
+								map_columns(rows);
 
-							// handle hit status
-							if (_hit &&
-								_point.x >= rect.left && _point.x <= rect.right &&
-								_point.y >= rect.top && _point.y <= rect.bottom)
-								hot = true;
-							else
-								hot = false;
+							p_rows = &rows;
 						}
 
+#if SELECTIONTIME
+						const auto start = std::chrono::steady_clock::now();
+#endif
+						bool selected = selected_rows.contains(row_number);
+#if SELECTIONTIME
+						selection_time += std::chrono::steady_clock::now() - start;
+#endif
+						const bool hot = row_hot && row_number == hot_row;
+
 						if (selected) {
 							auto rect = rect_row;
 							rect.left = _rectB.left;
@@ -465,7 +523,8 @@ namespace liblec {
 						auto rect_cell = rect_row;
 						rect_cell.right = rect_cell.left;
 
-						for (const auto& it : _specs.columns()) {
+						for (size_t column = 0; column < _specs.columns().size(); column++) {
+							const auto& it = _specs.columns()[column];
 							rect_cell.left = rect_cell.right;
 							rect_cell.right = rect_cell.left + static_cast<float>(it.width);
 
@@ -473,55 +532,66 @@ namespace liblec {
 							rect_text.left += _margin;
 							rect_text.right -= _margin;
 
+							if (!render || !_visible)
+								continue;
+
 							try {
-								std::string text;
+								const wchar_t* text = L"";
+								UINT32 text_length = 0;
+								wchar_t number[24];
 
 								if (_specs.fixed_number_column() && it.name == _specs.fixed_number_column_name()) {
-									text = std::to_string(row_number + 1);
+									const int length = swprintf(number, sizeof(number) / sizeof(number[0]), L"%lu", row_number + 1);
+									text = number;
+									text_length = length > 0 ? static_cast<UINT32>(length) : 0;
 								}
-								else {
-									const auto& value = _specs.data().at(row_number).at(it.name);
-									if (value.has_value()) {
-										// integer
-										if (value.type() == typeid(int))
-											text = std::to_string(get::integer(value));
-
-										// float, double
-										if (value.type() == typeid(float) || value.type() == typeid(double))
-											text = round_off::to_string(get::real(value), it.precision);
-
-										// const char*, string
-										if (value.type() == typeid(const char*) || value.type() == typeid(std::string))
-											text = get::text(value);
+								else
+									if (_column_index[column] != -1) {
+										const auto& cell = p_rows->display_text(data_row,
+											_column_index[column], it.precision);
+										text = cell.c_str();
+										text_length = static_cast<UINT32>(cell.length());
 									}
-								}
 
-								// create a text layout
-								HRESULT hr = _p_directwrite_factory->CreateTextLayout(
-									convert_string(text).c_str(),
-									(UINT32)text.length(),
-									_p_text_format,
-									rect_text.right - rect_text.left,
-									rect_text.bottom - rect_text.top,
-									&_p_text_layout);
+								// get the cell's text layout, which is only made if the cell is new or has changed
+								const unsigned long long key =
+									(static_cast<unsigned long long>(row_number) << 16) | column;
 
-								if (SUCCEEDED(hr) && render && _visible) {
+								auto p_text_layout = text_layout(_cell_layouts[key],
+									text, text_length, rect_text, false);
+
+								if (p_text_layout) {
 									// draw the text layout
 									p_render_target->DrawTextLayout(
 										D2D1_POINT_2F{ rect_text.left, rect_text.top },
-										_p_text_layout,
+										p_text_layout,
 										selected ? _p_brush_text_selected : _p_brush,
 										D2D1_DRAW_TEXT_OPTIONS_CLIP);
 								}
-
-								// release the text layout
-								safe_release(&_p_text_layout);
 							}
 							catch (const std::exception&) {}
 						}
 					}
 				}
 
+				// step11d: release the text layouts of cells that are no longer in view
+				if (render && _visible) {
+					release_layouts(true);
+
+#if LAYOUTCOUNT
+					log("text layouts created: " + std::to_string(_layouts_created) +
+						", reused: " + std::to_string(_layouts_reused));
+#endif
+
+#if SELECTIONTIME
+					if (render && _visible)
+						log("selection checks: " + std::to_string(
+							std::chrono::duration_cast<std::chrono::nanoseconds>(selection_time).count()) +
+							"ns, selected rows: " + std::to_string(selected_rows.count()) +
+							", ranges: " + std::to_string(_specs._selected_ranges.size()));
+#endif
+				}
+
 				// step12: draw grid
 				if (render && _visible) {
 					// step12a: draw horizontal lines
@@ -558,6 +628,8 @@ namespace liblec {
 		}
 
 		void widgets::table_view_impl::on_click() {
+			sync_data();
+
 			if (true) {
 				if (_book_on_selection) {
 					if (_specs.events().selection)
@@ -572,67 +644,46 @@ namespace liblec {
 
 				// check if any of the rows have been clicked
 				bool selection_made = false;
-				const auto& selected_previous = _specs.selected();
-				_specs.selected().clear();
+				auto selected_rows = selection();
+				const bool selected_previous = !selected_rows.empty();
 
-				for (auto& it : _hot_spots) {
-					auto rect = it.second;
-					scale_RECT(rect, get_dpi_scale());
+				unsigned long row_clicked = 0;
 
-					if (_point.x >= rect.left && _point.x <= rect.right &&
-						_point.y >= rect.top && _point.y <= rect.bottom) {
-						// change the selection
-						selection_made = true;
-
-						if (ctrl_pressed) {
-							if (std::find(selected_previous.begin(), selected_previous.end(),
-								it.first) == selected_previous.end()) {
-								// add this row to the current selection, using the
-								// order in which items appear in the table
-								for (unsigned long row_number = 0; row_number < _specs.data().size();
-									row_number++) {
-									if (row_number == it.first)
-										_specs.selected().push_back(row_number);
-									else
-										if (std::find(selected_previous.begin(), selected_previous.end(),
-											row_number) != selected_previous.end())
-											_specs.selected().push_back(row_number);
-								}
-							}
-							else
-							{
-								// de-select this item
-								for (const auto& m_it : selected_previous) {
-									if (m_it == it.first)
-										continue;
-									_specs.selected().push_back(m_it);
-								}
-							}
-						}
+				if (row_at(_point, row_clicked)) {
+					// change the selection
+					selection_made = true;
+					const long row = static_cast<long>(row_clicked);
+
+					if (ctrl_pressed) {
+						if (!selected_rows.contains(row))
+							selected_rows.add(row, row);	// add this row to the current selection
 						else
-							if (shift_pressed && !selected_previous.empty()) {
-								// select all items beginning with the last selected item and this one
-								if (it.first > _last_selected)
-									for (unsigned long current_row = _last_selected;
-										current_row <= it.first; current_row++)
-										_specs.selected().push_back(current_row);
-								else
-									for (unsigned long current_row = it.first;
-										current_row <= _last_selected; current_row++)
-										_specs.selected().push_back(current_row);
-							}
-							else
-								_specs.selected().push_back(it.first);
-
-						/// Last selected item algorithm:
-						/// 
-						/// It's the item that's selected when when there is no selection or the item
-						/// that's selected with shift is not pressed
-						if (selected_previous.empty() || !shift_pressed)
-							_last_selected = it.first;
+							selected_rows.remove(row);		// de-select this item
 					}
+					else
+						if (shift_pressed && selected_previous) {
+							// select all items beginning with the last selected item and this one
+							selected_rows.clear();
+							selected_rows.add(static_cast<long>(_last_selected), row);
+						}
+						else {
+							selected_rows.clear();
+							selected_rows.add(row, row);
+						}
+
+					/// Last selected item algorithm:
+					/// 
+					/// It's the item that's selected when when there is no selection or the item
+					/// that's selected with shift is not pressed
+					if (!selected_previous || !shift_pressed)
+						_last_selected = row_clicked;
 				}
 
+				if (!selection_made)
+					selected_rows.clear();
+
+				_specs._selected_stale = true;
+
 				if (selection_made) {
 					if (_specs.events().selection)
 						on_selection();
@@ -653,8 +704,27 @@ namespace liblec {
 
 					if (_point.x >= rect.left && _point.x <= rect.right &&
 						_point.y >= rect.top && _point.y <= rect.bottom) {
+						if (_sort_result.valid()) {
+							log("sort still in progress");
+							break;
+						}
+
 						// column has been clicked for sorting
 						try {
+							if (!shift_pressed) {
+								// sort by this column alone
+								_sort_columns = { name };
+
+								// reset the other sort options
+								for (auto& it : _header_sort_options) {
+									if (it.first != name)
+										it.second = sort_options::none;
+								}
+							}
+							else
+								if (std::find(_sort_columns.begin(), _sort_columns.end(), name) == _sort_columns.end())
+									_sort_columns.push_back(name);	// add this column to the sort columns
+
 							if (_header_sort_options.count(name)) {
 								// sort option entry already exists ... flip it
 								auto& sort_option = _header_sort_options.at(name);
@@ -674,80 +744,9 @@ namespace liblec {
 								_header_sort_options.insert(std::make_pair(name, sort_options::ascending));
 
 							// do the sorting
-							switch (_header_sort_options.at(name)) {
-							case sort_options::ascending: {
-								log(name + ": sort ascending");
-
-								const std::string column_name(name);
-
-								auto compare_by_column_for_ascending = [&](const lecui::table_row& a, const lecui::table_row& b)->bool {
-									const auto& a_value = a.at(column_name);
-									const auto& b_value = b.at(column_name);
-
-									if (!a_value.has_value() || !b_value.has_value())
-										return true;
-
-									if (a_value.type() != b_value.type())
-										return true;
-
-									if (a_value.type() == typeid(int))
-										return get::integer(a_value) < get::integer(b_value);
-
-									if (a_value.type() == typeid(float) || a_value.type() == typeid(double))
-										return get::real(a_value) < get::real(b_value);
-
-									if (a_value.type() == typeid(std::string) || a_value.type() == typeid(const char*))
-										return get::text(a_value) < get::text(b_value);
-
-									return true;
-								};
-
-								// sort
-								std::sort(_specs.data().begin(), _specs.data().end(), compare_by_column_for_ascending);
-							} break;
-
-							case sort_options::descending: {
-								log(name + ": sort descending");
-
-								const std::string column_name(name);
-
-								auto compare_by_column_for_descending = [&](const lecui::table_row& a, const lecui::table_row& b)->bool {
-									const auto& a_value = a.at(column_name);
-									const auto& b_value = b.at(column_name);
-
-									if (!a_value.has_value() || !b_value.has_value())
-										return false;
-
-									if (a_value.type() != b_value.type())
-										return false;
-
-									if (a_value.type() == typeid(int))
-										return get::integer(a_value) > get::integer(b_value);
-
-									if (a_value.type() == typeid(float) || a_value.type() == typeid(double))
-										return get::real(a_value) > get::real(b_value);
-
-									if (a_value.type() == typeid(std::string) || a_value.type() == typeid(const char*))
-										return get::text(a_value) > get::text(b_value);
-
-									return false;
-								};
-
-								// sort
-								std::sort(_specs.data().begin(), _specs.data().end(), compare_by_column_for_descending);
-							} break;
-
-							case sort_options::none:
-							default:
-								log(name + ": no sorting");
-								break;
-							}
-
-							// reset the other sort options
-							for (auto& it : _header_sort_options) {
-								if (it.first != name)
-									it.second = sort_options::none;
-							}
+							log(name + (_header_sort_options.at(name) == sort_options::ascending ?
+								": sort ascending" : ": sort descending"));
+							sort_rows();
 						}
 						catch (const std::exception& e) { log(e.what()); }
 					}
@@ -756,8 +755,21 @@ namespace liblec {
 		}
 
 		bool widgets::table_view_impl::on_keydown(WPARAM wParam) {
+			sync_data();
+
 			float adjustment = 0.f;
 
+			if (wParam == 'A' && (GetKeyState(VK_CONTROL) & 0x8000) && row_count() > 0) {
+				// select all the rows
+				auto selected_rows = selection();
+				selected_rows.clear();
+				selected_rows.add(0, static_cast<long>(row_count() - 1));
+				_specs._selected_stale = true;
+
+				_book_on_selection = true;
+				return true;
+			}
+
 			switch (wParam) {
 			case VK_UP:
 				adjustment = _row_height;
@@ -770,17 +782,20 @@ namespace liblec {
 			}
 
 			if (adjustment != 0.f) {
-				if (_specs.selected().empty()) {
+				auto selected_rows = selection();
+
+				if (selected_rows.empty()) {
 					// simple scrolling
 				}
 				else {
 					// move last selection one unit (unless it's at the beginning or the end)
-					long new_selection = smallest(static_cast<long>(_specs.data().size() - 1),
+					long new_selection = smallest(static_cast<long>(row_count() - 1),
 						largest(0L, static_cast<long>(_last_selected) -
 							static_cast<long>(adjustment / _row_height)));
 
-					_specs.selected().clear();
-					_specs.selected().push_back(new_selection);
+					selected_rows.clear();
+					selected_rows.add(new_selection, new_selection);
+					_specs._selected_stale = true;
 					_last_selected = new_selection;
 
 					// check out if new selection is within table area
@@ -810,6 +825,8 @@ namespace liblec {
 				return false;
 		}
 
+		bool widgets::table_view_impl::bounds_from_specs() { return false; }
+
 		bool widgets::table_view_impl::hit(const bool& hit) {
 			if (_is_static || hit == _hit) {
 				if (hit || _pressed)
@@ -823,11 +840,17 @@ namespace liblec {
 		}
 
 		void widgets::table_view_impl::on_right_click() {
+			sync_data();
+
 			if (_specs.events().context_menu) {
 				std::vector<table_row> var;
-				for (const auto& it : _specs.selected()) {
-					try { var.push_back(_specs.data().at(it)); }
-					catch (const std::exception&) {}
+				var.reserve(selection().count());
+
+				for (const auto& [first, last] : _specs._selected_ranges) {
+					for (long row = first; row <= last; row++) {
+						try { var.push_back(get_row(static_cast<size_t>(row))); }
+						catch (const std::exception&) {}
+					}
 				}
 
 				_specs.events().context_menu(var);
@@ -840,19 +863,272 @@ namespace liblec {
 		widgets::table_view&
 			widgets::table_view_impl::specs() { return _specs; }
 
+		unsigned long widgets::table_view_impl::layouts_created() { return _layouts_created; }
+
+		unsigned long widgets::table_view_impl::layouts_reused() { return _layouts_reused; }
+
 		widgets::table_view&
 			widgets::table_view_impl::operator()() { return specs(); }
 
 		void widgets::table_view_impl::on_selection() {
 			if (_specs.events().selection) {
 				std::vector<table_row> var;
-				for (const auto& it : _specs.selected()) {
-					try { var.push_back(_specs.data().at(it)); }
-					catch (const std::exception&) {}
+				var.reserve(selection().count());
+
+				for (const auto& [first, last] : _specs._selected_ranges) {
+					for (long row = first; row <= last; row++) {
+						try { var.push_back(get_row(static_cast<size_t>(row))); }
+						catch (const std::exception&) {}
+					}
 				}
 
 				_specs.events().selection(var);
 			}
 		}
+
+		void widgets::table_view_impl::sync_data() {
+			if (virtual_mode()) {
+				if (_virtual_data_generation != _specs._virtual_data_generation) {
+					// the application's rows may have changed
+					_cache.clear();
+					_cache_index.clear();
+					_virtual_data_generation = _specs._virtual_data_generation;
+				}
+
+				return;
+			}
+
+			if (_specs._columnar || _data_generation == _specs._data_generation)
+				return;
+
+			// the rows have been accessed through data() since they were last read
+			_specs._table_data.assign(_specs._data);
+			_data_generation = _specs._data_generation;
+		}
+
+		row_ranges widgets::table_view_impl::selection() {
+			if (_selected_generation != _specs._selected_generation) {
+				// the list may have been changed through selected() since it was last read
+				row_ranges(_specs._selected_ranges).assign(_specs._selected);
+				_selected_generation = _specs._selected_generation;
+			}
+
+			return row_ranges(_specs._selected_ranges);
+		}
+
+		void widgets::table_view_impl::sort_rows() {
+			if (virtual_mode() || _sort_result.valid())
+				return;
+
+			std::vector<lecui::table_data::sort_column> columns;
+
+			for (const auto& name : _sort_columns) {
+				const auto column = _specs._table_data.find_column(name);
+
+				if (column != -1)
+					columns.push_back({ static_cast<size_t>(column),
+						_header_sort_options.at(name) != sort_options::descending });
+			}
+
+			if (columns.empty())
+				return;
+
+			// the keys are read here, so the table data isn't touched by the sort
+			std::vector<unsigned long long> keys;
+			std::vector<lecui::table_data::text_keys> texts;
+			_specs._table_data.sort_keys(columns, keys, texts);
+			const size_t rows = _specs._table_data.rows();
+
+			if (rows < async_sort_rows) {
+				lecui::table_data::rank_text(texts, rows, keys);
+				lecui::table_data::sort_order(keys, rows, _sort_order);
+				apply_sort_order();
+				return;
+			}
+
+			// the rows may be changed by the app while they are being sorted
+			_sort_data_generation = _specs._data_generation;
+
+			// rank the text and sort on another thread so that the form keeps responding to input
+			_sort_result = std::async(std::launch::async,
+				[keys = std::move(keys), texts = std::move(texts), rows]() mutable {
+				lecui::table_data::rank_text(texts, rows, keys);
+
+				std::vector<size_t> order;
+				lecui::table_data::sort_order(keys, rows, order);
+				return order;
+				});
+
+			timer_manager(get_form()).add(_sort_timer_name, 15,
+				[&]() {
+					if (_sort_result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+						return;
+
+					timer_manager(get_form()).stop(_sort_timer_name);
+
+					try {
+						_sort_order = _sort_result.get();
+
+						if (_specs._data_generation == _sort_data_generation)
+							apply_sort_order();
+						else
+							log("table data changed while sorting");
+					}
+					catch (const std::exception& e) { log(e.what()); }
+
+					get_form()._d.update();
+				});
+		}
+
+		void widgets::table_view_impl::apply_sort_order() {
+			if (_sort_order.size() != _specs._table_data.rows()) {
+				log("table rows changed while sorting");
+				return;
+			}
+
+			_specs._table_data.reorder(_sort_order);
+
+			if (!_specs._columnar && _specs._data.size() == _sort_order.size()) {
+				// keep the rows in data() in the same order
+				std::vector<table_row> data;
+				data.reserve(_specs._data.size());
+
+				for (const auto& row : _sort_order)
+					data.push_back(std::move(_specs._data[row]));
+
+				_specs._data.swap(data);
+			}
+		}
+
+		bool widgets::table_view_impl::row_at(const D2D1_POINT_2F& point, unsigned long& row) {
+			// the point is in pixels and the table is laid out in DIPs
+			const float x = point.x / get_dpi_scale();
+			const float y = point.y / get_dpi_scale();
+
+			if (x < _rect_rows.left || x > _rect_rows.right ||
+				y < _rect_rows.top || y > _rect_rows.bottom || y < _rectA.top)
+				return false;
+
+			// rows are of uniform height, so the row follows from the distance to the first one
+			const auto index = static_cast<size_t>((y - _rectA.top) / _row_height);
+
+			if (index >= row_count())
+				return false;
+
+			row = static_cast<unsigned long>(index);
+			return true;
+		}
+
+		bool widgets::table_view_impl::virtual_mode() {
+			return _specs._virtual_data.fetch != nullptr;
+		}
+
+		size_t widgets::table_view_impl::row_count() {
+			return virtual_mode() ? _specs._virtual_data.rows : _specs._table_data.rows();
+		}
+
+		const lecui::table_data&
+			widgets::table_view_impl::cached_rows(const size_t& row, size_t& block_row) {
+			const size_t block = row / cache_block_rows;
+			block_row = row % cache_block_rows;
+
+			auto it = _cache_index.find(block);
+
+			if (it != _cache_index.end())
+				_cache.splice(_cache.begin(), _cache, it->second);	// make it the most recently used
+			else {
+				// fetch the block
+				_cache.emplace_front();
+				auto& fetched = _cache.front();
+				fetched.block = block;
+				_cache_index[block] = _cache.begin();
+
+				const size_t first_row = block * cache_block_rows;
+				const size_t count = first_row < _specs._virtual_data.rows ?
+					smallest(cache_block_rows, _specs._virtual_data.rows - first_row) : 0;
+
+				try { fetched.rows.assign(_specs._virtual_data.fetch(first_row, count)); }
+				catch (const std::exception& e) { log(e.what()); }
+
+				// drop the least recently used blocks
+				const size_t capacity = largest(_specs._virtual_data.cache_rows / cache_block_rows,
+					_cache_min_blocks);
+
+				while (_cache.size() > capacity) {
+					_cache_index.erase(_cache.back().block);
+					_cache.pop_back();
+				}
+			}
+
+			// rows the application didn't give are left empty
+			auto& rows = _cache.front().rows;
+			while (rows.rows() <= block_row)
+				rows.add_row();
+
+			return rows;
+		}
+
+		table_row widgets::table_view_impl::get_row(const size_t& row) {
+			if (virtual_mode()) {
+				if (row >= row_count())
+					throw std::out_of_range("Row " + std::to_string(row) + " does not exist");
+
+				size_t block_row = 0;
+				return cached_rows(row, block_row).row(block_row);
+			}
+
+			return _specs._columnar ? _specs._table_data.row(row) : _specs._data.at(row);
+		}
+
+		IDWriteTextLayout* widgets::table_view_impl::text_layout(cached_layout& layout,
+			const wchar_t* text, const UINT32& length, const D2D1_RECT_F& rect, const bool& bold) {
+			const size_t text_hash = std::hash<std::wstring_view>()(std::wstring_view(text, length));
+			const float width = rect.right - rect.left;
+			const float height = rect.bottom - rect.top;
+
+			layout.frame = _frame;
+
+			if (layout.p_layout && layout.text_hash == text_hash &&
+				layout.width == width && layout.height == height) {
+				_layouts_reused++;
+				return layout.p_layout;
+			}
+
+			safe_release(&layout.p_layout);
+
+			HRESULT hr = _p_directwrite_factory->CreateTextLayout(text, length,
+				_p_text_format, width, height, &layout.p_layout);
+
+			if (FAILED(hr)) {
+				layout.p_layout = nullptr;
+				return nullptr;
+			}
+
+			if (bold)
+				layout.p_layout->SetFontWeight(DWRITE_FONT_WEIGHT_BOLD, { 0, length });
+
+			layout.text_hash = text_hash;
+			layout.width = width;
+			layout.height = height;
+			_layouts_created++;
+			return layout.p_layout;
+		}
+
+		void widgets::table_view_impl::release_layouts(const bool& unused_only) {
+			auto release = [&](auto& layouts) {
+				for (auto it = layouts.begin(); it != layouts.end();) {
+					if (unused_only && it->second.frame == _frame) {
+						it++;
+						continue;
+					}
+
+					safe_release(&it->second.p_layout);
+					it = layouts.erase(it);
+				}
+			};
+
+			release(_cell_layouts);
+			release(_header_layouts);
+		}
 	}
 }
@@ -12,6 +12,11 @@
 
 #include "../widget_impl.h"
 #include "../table_view.h"
+#include "row_ranges.h"
+
+#include <future>
+#include <list>
+#include <unordered_map>
 
 namespace liblec {
 	namespace lecui {
@@ -45,6 +50,10 @@ namespace liblec {
 				widgets::table_view& specs();
 				widgets::table_view& operator()();
 
+				/// the number of text layouts created and reused in the last frame drawn
+				unsigned long layouts_created();
+				unsigned long layouts_reused();
+
 			private:
 				// Default constructor and copying an object of this class are not allowed
 				table_view_impl() = delete;
@@ -52,7 +61,7 @@ namespace liblec {
 				table_view_impl& operator=(const table_view_impl&) = delete;
 
 				/// Private variables
-				widgets::table_view _specs, _specs_old;
+				widgets::table_view _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_text_header;
@@ -70,21 +79,72 @@ namespace liblec {
 				IDWriteTextFormat* _p_text_format;
 
 				IDWriteFactory* _p_directwrite_factory;
-				IDWriteTextLayout* _p_text_layout;
 
 				D2D1_RECT_F _rectA, _rectB;
 				float _row_height;
 				float _margin;
 				D2D1_RECT_F _rect_header;
-				std::map<unsigned long, D2D1_RECT_F> _hot_spots;
+				D2D1_RECT_F _rect_rows;	// the part of the table in which rows can be seen
 				std::map<std::string, D2D1_RECT_F> _header_hot_spots;
 				std::map<std::string, sort_options> _header_sort_options;
 				unsigned long _last_selected;
 
 				bool _book_on_selection;
 
+				unsigned long long _data_generation;
+				unsigned long long _selected_generation;
+				std::vector<long> _column_index;	// columnar data column of each table column
+				std::vector<std::string> _sort_columns;	// most significant first
+				std::vector<size_t> _sort_order;
+				std::future<std::vector<size_t>> _sort_result;	// set while a sort is in progress
+				unsigned long long _sort_data_generation;	// that of the data being sorted
+				const std::string _sort_timer_name;
+
+				/// A block of rows fetched in virtual mode
+				struct cached_block {
+					size_t block = 0;
+					lecui::table_data rows;
+				};
+
+				std::list<cached_block> _cache;	// most recently used first
+				std::unordered_map<size_t, std::list<cached_block>::iterator> _cache_index;
+				size_t _cache_min_blocks;
+				unsigned long long _virtual_data_generation;
+
+				/// A text layout kept across frames. It is remade when the text or the space
+				/// available to it changes.
+				struct cached_layout {
+					IDWriteTextLayout* p_layout = nullptr;
+					size_t text_hash = 0;
+					float width = 0.f;
+					float height = 0.f;
+					unsigned long long frame = 0;	// the last frame it was used in
+				};
+
+				std::unordered_map<unsigned long long, cached_layout> _cell_layouts;	// keyed on row and column
+				std::unordered_map<size_t, cached_layout> _header_layouts;	// keyed on column
+				unsigned long long _frame;
+				unsigned long _layouts_created;
+				unsigned long _layouts_reused;
+
+				/// The table's bounds follow its columns and rows, which the specs' change generation
+				/// doesn't track.
+				bool bounds_from_specs() override;
+
 				/// Private methods
 				void on_selection();
+				void sync_data();
+				row_ranges selection();
+				void sort_rows();
+				void apply_sort_order();
+				bool row_at(const D2D1_POINT_2F& point, unsigned long& row);
+				bool virtual_mode();
+				size_t row_count();
+				const lecui::table_data& cached_rows(const size_t& row, size_t& block_row);
+				table_row get_row(const size_t& row);
+				IDWriteTextLayout* text_layout(cached_layout& layout, const wchar_t* text,
+					const UINT32& length, const D2D1_RECT_F& rect, const bool& bold);
+				void release_layouts(const bool& unused_only = false);
 			};
 		}
 	}
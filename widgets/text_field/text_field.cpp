@@ -59,59 +59,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::text_field::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::text_field::cursor() { _generation++; return _cursor; }
 
 		widgets::text_field& widgets::text_field::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::text_field::font() { return _font; }
+		std::string& widgets::text_field::font() { _generation++; return _font; }
 
 		widgets::text_field& widgets::text_field::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::text_field::font_size() { return _font_size; }
+		float& widgets::text_field::font_size() { _generation++; return _font_size; }
 
 		widgets::text_field& widgets::text_field::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::text_field::color_text() { return _color_text; }
+		color& widgets::text_field::color_text() { _generation++; return _color_text; }
 
 		widgets::text_field& widgets::text_field::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::text_field::color_fill() { return _color_fill; }
+		color& widgets::text_field::color_fill() { _generation++; return _color_fill; }
 
 		widgets::text_field& widgets::text_field::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::text_field::color_hot() { return _color_hot; }
+		color& widgets::text_field::color_hot() { _generation++; return _color_hot; }
 
 		widgets::text_field& widgets::text_field::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::text_field::color_selected() { return _color_selected; }
+		color& widgets::text_field::color_selected() { _generation++; return _color_selected; }
 
 		widgets::text_field& widgets::text_field::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::text_field::color_disabled() { return _color_disabled; }
+		color& widgets::text_field::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::text_field& widgets::text_field::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -122,10 +130,11 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::text_field::color_border() { return _color_border; }
+		lecui::color& widgets::text_field::color_border() { _generation++; return _color_border; }
 
 		widgets::text_field& widgets::text_field::color_border(const color& color_border) {
 			_color_border = color_border;
+			_generation++;
 			return *this;
 		}
 
@@ -150,24 +159,27 @@ namespace liblec {
 			return *this;
 		}
 
-		lecui::color& widgets::text_field::color_prompt() { return _color_prompt; }
+		lecui::color& widgets::text_field::color_prompt() { _generation++; return _color_prompt; }
 
 		widgets::text_field& widgets::text_field::color_prompt(const color& color_prompt) {
 			_color_prompt = color_prompt;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::text_field::color_caret() { return _color_caret; }
+		lecui::color& widgets::text_field::color_caret() { _generation++; return _color_caret; }
 
 		widgets::text_field& widgets::text_field::color_caret(const color& color_caret) {
 			_color_caret = color_caret;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::text_field::color_input_error() { return _color_input_error; }
+		color& widgets::text_field::color_input_error() { _generation++; return _color_input_error; }
 
 		widgets::text_field& widgets::text_field::color_input_error(const color& color_input_error) {
 			_color_input_error = color_input_error;
+			_generation++;
 			return *this;
 		}
 
@@ -282,26 +294,12 @@ namespace liblec {
 
 		widgets::text_field&
 			widgets::text_field_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_text_field_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_text_field_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_text_field_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
@@ -50,7 +50,6 @@ namespace liblec {
 
 		HRESULT widgets::text_field_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = false;
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -119,12 +118,14 @@ namespace liblec {
 		D2D1_RECT_F&
 			widgets::text_field_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -333,7 +334,7 @@ namespace liblec {
 							_skip_blink = false;
 						else {
 							_caret_visible = !_caret_visible;
-							get_form().update();
+							invalidate();
 						}
 					});
 			}
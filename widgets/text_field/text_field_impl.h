@@ -56,7 +56,7 @@ namespace liblec {
 				text_field_impl& operator=(const text_field_impl&) = delete;
 
 				/// Private variables
-				widgets::text_field _specs, _specs_old;
+				widgets::text_field _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_caret;
 				ID2D1SolidColorBrush* _p_brush_prompt;
@@ -67,7 +67,7 @@ namespace liblec {
 				time_impl& operator=(const time_impl&) = delete;
 
 				/// Private variables
-				widgets::time _specs, _specs_old;
+				widgets::time _specs;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
@@ -55,59 +55,67 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::toggle::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::toggle::cursor() { _generation++; return _cursor; }
 
 		widgets::toggle& widgets::toggle::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::toggle::font() { return _font; }
+		std::string& widgets::toggle::font() { _generation++; return _font; }
 
 		widgets::toggle& widgets::toggle::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::toggle::font_size() { return _font_size; }
+		float& widgets::toggle::font_size() { _generation++; return _font_size; }
 
 		widgets::toggle& widgets::toggle::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::toggle::color_text() { return _color_text; }
+		color& widgets::toggle::color_text() { _generation++; return _color_text; }
 
 		widgets::toggle& widgets::toggle::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::toggle::color_fill() { return _color_fill; }
+		color& widgets::toggle::color_fill() { _generation++; return _color_fill; }
 
 		widgets::toggle& widgets::toggle::color_fill(const color& color_fill) {
 			_color_fill = color_fill;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::toggle::color_hot() { return _color_hot; }
+		color& widgets::toggle::color_hot() { _generation++; return _color_hot; }
 
 		widgets::toggle& widgets::toggle::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::toggle::color_selected() { return _color_selected; }
+		color& widgets::toggle::color_selected() { _generation++; return _color_selected; }
 
 		widgets::toggle& widgets::toggle::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::toggle::color_disabled() { return _color_disabled; }
+		color& widgets::toggle::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::toggle& widgets::toggle::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -118,17 +126,19 @@ namespace liblec {
 			return *this;
 		}
 
-		color& widgets::toggle::color_on() { return _color_on; }
+		color& widgets::toggle::color_on() { _generation++; return _color_on; }
 
 		widgets::toggle& widgets::toggle::color_on(const color& color_on) {
 			_color_on = color_on;
+			_generation++;
 			return *this;
 		}
 
-		lecui::color& widgets::toggle::color_off() { return _color_off; }
+		lecui::color& widgets::toggle::color_off() { _generation++; return _color_off; }
 
 		widgets::toggle& widgets::toggle::color_off(const color& color_off) {
 			_color_off = color_off;
+			_generation++;
 			return *this;
 		}
 
@@ -223,26 +233,12 @@ namespace liblec {
 
 		widgets::toggle&
 			widgets::toggle_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_toggle_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_toggle_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_toggle_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
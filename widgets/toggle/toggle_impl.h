@@ -53,8 +53,11 @@ namespace liblec {
 				toggle_impl(const toggle_impl&) = delete;
 				toggle_impl& operator=(const toggle_impl&) = delete;
 
+				/// The rect depends on the text and status, which are set without touching the generation.
+				bool bounds_from_specs() override;
+
 				/// Private variables
-				widgets::toggle _specs, _specs_old;
+				widgets::toggle _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_fill;
 				ID2D1SolidColorBrush* _p_brush_on;
@@ -35,6 +35,11 @@ namespace liblec {
 					/// <summary>The node's children.</summary>
 					std::map<std::string, node> children;
 
+					/// <summary>Whether the node has children that are yet to be added. The expand
+					/// marker is drawn for such a node, and its children are expected to be added in
+					/// the <see cref="tree_view_events::expand"></see> event.</summary>
+					bool children_pending = false;
+
 					/// <summary>Node constructor.</summary>
 					/// <param name="name">The name of the node.</param>
 					node(std::string name) :
@@ -45,8 +50,14 @@ namespace liblec {
 					node() {}
 
 					bool selected = false;
-					lecui::rect rc = { 0.f, 0.f, 0.f, 0.f };
-					lecui::rect rc_expand = { 0.f, 0.f, 0.f, 0.f };
+
+					/// <summary>Whether the children of the node were added in the expand event,
+					/// so that they can be removed when it is collapsed. Only tree_view_impl sets
+					/// it, the way it does <see cref="tree_data::loaded"></see>.</summary>
+					/// <remarks>Declared outside the LECUI_EXPORTS block, unlike tree_data's,
+					/// because it is a field and the node must have the same layout in the
+					/// library and in the application.</remarks>
+					bool loaded = false;
 
 #if defined(LECUI_EXPORTS)
 					friend class widgets::tree_view_impl;
@@ -59,6 +70,10 @@ namespace liblec {
 				float _corner_radius_x = 5.f;
 				float _corner_radius_y = 5.f;
 				std::map<std::string, node> _root;
+				lecui::tree_data _node_data;
+				bool _use_node_data = false;
+				bool _unload_on_collapse = false;
+				unsigned long long _root_generation = 0;
 				void* _p_special_pane_specs = nullptr;
 
 			public:
@@ -83,6 +98,23 @@ namespace liblec {
 					/// <summary>Selection event. Happens when the selection changes. The
 					/// parameter will contain a reference to the newly selected node.</summary>
 					std::function<void(node& n)> selection;
+
+					/// <summary>Expand event. Happens when a node is expanded, before its children
+					/// are shown. The parameter will contain a reference to the node. Add the children
+					/// of nodes marked with <see cref="node::children_pending"></see> here.</summary>
+					std::function<void(node& n)> expand;
+
+					/// <summary>Node data selection event. Happens instead of the selection event
+					/// when the tree is shown from <see cref="node_data"></see>. The parameter is the
+					/// handle of the newly selected node.</summary>
+					std::function<void(const size_t& node)> node_data_selection;
+
+					/// <summary>Node data expand event. Happens instead of the expand event when the
+					/// tree is shown from <see cref="node_data"></see>. The parameter is the handle of
+					/// the node. Add the children of nodes marked with
+					/// <see cref="tree_data::children_pending"></see> here, through
+					/// <see cref="node_data"></see>.</summary>
+					std::function<void(const size_t& node)> node_data_expand;
 				};
 
 				/// <summary>Get or set tree view widget events.</summary>
@@ -267,7 +299,9 @@ namespace liblec {
 
 				/// <summary>Get or set the root of the tree.</summary>
 				/// <returns>A reference to the root.</returns>
-				/// <remarks>The entire tree is built recursively on this root.</remarks>
+				/// <remarks>The entire tree is built recursively on this root. The rows of the tree
+				/// are laid out again whenever this is called, so avoid calling it needlessly on large
+				/// trees.</remarks>
 				std::map<std::string, node>& root();
 
 				/// <summary>Set the root of the tree.</summary>
@@ -275,6 +309,36 @@ namespace liblec {
 				/// <returns>A reference to the modified object.</returns>
 				tree_view& root(const std::map<std::string, node>& root);
 
+				/// <summary>Get or set whether to remove the children of a node when it is collapsed.</summary>
+				/// <returns>A reference to the property.</returns>
+				/// <remarks>Only children added in the <see cref="tree_view_events::expand"></see>
+				/// or <see cref="tree_view_events::node_data_expand"></see> event are removed. The node
+				/// is marked with <see cref="node::children_pending"></see>, or with
+				/// <see cref="tree_data::children_pending"></see>, so its children are added again the
+				/// next time it is expanded.</remarks>
+				bool& unload_on_collapse();
+
+				/// <summary>Set whether to remove the children of a node when it is collapsed.</summary>
+				/// <param name="unload_on_collapse">Whether to remove the children.</param>
+				/// <returns>A reference to the modified object.</returns>
+				tree_view& unload_on_collapse(const bool& unload_on_collapse);
+
+				/// <summary>Get or set the tree's nodes in the form of tree data. Use this instead
+				/// of <see cref="root"></see> for large trees.</summary>
+				/// <returns>A reference to the tree data.</returns>
+				/// <remarks>Once this is called the tree shows the tree data and the nodes set
+				/// through <see cref="root"></see> are ignored. The rows of the tree are laid out
+				/// again whenever this is called.</remarks>
+				lecui::tree_data& node_data();
+
+				/// <summary>Set the tree's nodes in the form of tree data. Use this instead of
+				/// <see cref="root"></see> for large trees.</summary>
+				/// <param name="node_data">The tree data.</param>
+				/// <returns>A reference to the modified object.</returns>
+				/// <remarks>Once this is called the nodes set through <see cref="root"></see> are
+				/// ignored.</remarks>
+				tree_view& node_data(const lecui::tree_data& node_data);
+
 			public:
 				/// <summary>Add a tree view to a container.</summary>
 				/// <param name="page">The container to place the widget in.</param>
@@ -300,6 +364,7 @@ namespace liblec {
 
 #if defined(LECUI_EXPORTS)
 				friend class form;
+				friend class tree_view_impl;
 #endif
 			};
 		}
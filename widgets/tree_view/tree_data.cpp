@@ -0,0 +1,321 @@
+//
+// tree_data.cpp - tree data implementation
+//
+// lecui user interface library, part of the liblec library
+// Copyright (c) 2019 Alec Musasa (alecmus at live dot com)
+//
+// Released under the MIT license. For full details see the
+// file LICENSE.txt
+//
+
+#include "../../form_common.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace liblec {
+	namespace lecui {
+		class tree_data::impl {
+		public:
+			// links are 32-bit indices into _nodes, with nil standing for none
+			static constexpr std::uint32_t nil = static_cast<std::uint32_t>(-1);
+
+			struct node {
+				std::uint32_t name = 0;	// index into the string pool
+				std::uint32_t parent = nil;
+				std::uint32_t first_child = nil;
+				std::uint32_t last_child = nil;
+				std::uint32_t next_sibling = nil;
+				bool expand = false;
+				bool children_pending = false;
+				bool loaded = false;
+				bool removed = false;
+			};
+
+			std::vector<node> _nodes;
+			std::vector<std::uint32_t> _free;	// the slots of removed nodes
+			node _top;	// the parent of the top level nodes; only its child links are used
+
+			// string pool, with the number of nodes that use each string. The slots of strings
+			// that are no longer used are emptied and reused
+			std::deque<std::string> _strings;
+			std::vector<std::uint32_t> _string_uses;
+			std::vector<std::uint32_t> _free_strings;
+			std::unordered_map<std::string_view, std::uint32_t> _string_index;
+
+			impl() {}
+
+			impl(const impl& right) { *this = right; }
+
+			impl& operator=(const impl& right) {
+				if (this == &right)
+					return *this;
+
+				_nodes = right._nodes;
+				_top = right._top;
+				_free = right._free;
+
+				// the pool's keys point into the strings, so they have to be rebuilt
+				_strings = right._strings;
+				_string_uses = right._string_uses;
+				_free_strings = right._free_strings;
+				_string_index.clear();
+				for (std::uint32_t i = 0; i < _strings.size(); i++)
+					if (_string_uses[i])
+						_string_index.emplace(_strings[i], i);
+
+				return *this;
+			}
+
+			std::uint32_t intern(const std::string& text) {
+				auto it = _string_index.find(text);
+				if (it != _string_index.end()) {
+					_string_uses[it->second]++;
+					return it->second;
+				}
+
+				std::uint32_t index = 0;
+
+				if (!_free_strings.empty()) {
+					index = _free_strings.back();
+					_free_strings.pop_back();
+					_strings[index] = text;
+				}
+				else {
+					index = static_cast<std::uint32_t>(_strings.size());
+					_strings.push_back(text);
+					_string_uses.push_back(0);
+				}
+
+				_string_uses[index] = 1;
+				_string_index.emplace(_strings[index], index);
+				return index;
+			}
+
+			void release(const std::uint32_t& index) {
+				if (--_string_uses[index])
+					return;
+
+				_string_index.erase(_strings[index]);
+				std::string().swap(_strings[index]);
+				_free_strings.push_back(index);
+			}
+
+			void check(const size_t& handle) const {
+				if (handle >= _nodes.size() || _nodes[handle].removed)
+					throw std::out_of_range("Node " + std::to_string(handle) + " does not exist");
+			}
+
+			node& get(const size_t& handle) {
+				if (handle == none)
+					return _top;
+
+				check(handle);
+				return _nodes[handle];
+			}
+
+			const node& get(const size_t& handle) const {
+				if (handle == none)
+					return _top;
+
+				check(handle);
+				return _nodes[handle];
+			}
+
+			static size_t to_handle(const std::uint32_t& link) {
+				return link == nil ? none : static_cast<size_t>(link);
+			}
+		};
+
+		tree_data::tree_data() :
+			_d(std::make_shared<impl>()) {}
+
+		tree_data::tree_data(const tree_data& right) :
+			_d(right._d) {}
+
+		tree_data& tree_data::operator=(const tree_data& right) {
+			_d = right._d;
+			return *this;
+		}
+
+		tree_data::~tree_data() {}
+
+		tree_data::impl& tree_data::modify() {
+			// the nodes are shared with copies until one of them is changed
+			if (_d.use_count() > 1)
+				_d = std::make_shared<impl>(*_d);
+
+			return *_d;
+		}
+
+		void tree_data::clear() { _d = std::make_shared<impl>(); }
+
+		size_t tree_data::size() const { return _d->_nodes.size() - _d->_free.size(); }
+
+		bool tree_data::contains(const size_t& node) const {
+			return node < _d->_nodes.size() && !_d->_nodes[node].removed;
+		}
+
+		void tree_data::reserve(const size_t& nodes) { modify()._nodes.reserve(nodes); }
+
+		size_t tree_data::add(const size_t& parent, const std::string& name) {
+			auto& d = modify();
+
+			if (d._free.empty() && d._nodes.size() >= impl::nil)
+				throw std::length_error("Too many nodes");
+
+			// check the parent before adding, since adding may move the nodes
+			d.get(parent);
+
+			impl::node n;
+			n.name = d.intern(name);
+			n.parent = parent == none ? impl::nil : static_cast<std::uint32_t>(parent);
+
+			std::uint32_t handle = 0;
+
+			if (!d._free.empty()) {
+				// reuse the slot of a removed node
+				handle = d._free.back();
+				d._free.pop_back();
+				d._nodes[handle] = n;
+			}
+			else {
+				handle = static_cast<std::uint32_t>(d._nodes.size());
+				d._nodes.push_back(n);
+			}
+
+			// append to the parent's children
+			auto& p = d.get(parent);
+
+			if (p.last_child == impl::nil)
+				p.first_child = handle;
+			else
+				d._nodes[p.last_child].next_sibling = handle;
+
+			p.last_child = handle;
+			return handle;
+		}
+
+		const std::string& tree_data::name(const size_t& node) const {
+			_d->check(node);
+			return _d->_strings[_d->_nodes[node].name];
+		}
+
+		size_t tree_data::parent(const size_t& node) const {
+			_d->check(node);
+			return impl::to_handle(_d->_nodes[node].parent);
+		}
+
+		size_t tree_data::first_child(const size_t& node) const {
+			return impl::to_handle(_d->get(node).first_child);
+		}
+
+		size_t tree_data::next_sibling(const size_t& node) const {
+			_d->check(node);
+			return impl::to_handle(_d->_nodes[node].next_sibling);
+		}
+
+		bool tree_data::expand(const size_t& node) const {
+			_d->check(node);
+			return _d->_nodes[node].expand;
+		}
+
+		tree_data& tree_data::expand(const size_t& node, const bool& expand) {
+			_d->check(node);
+
+			if (_d->_nodes[node].expand != expand)
+				modify()._nodes[node].expand = expand;
+
+			return *this;
+		}
+
+		bool tree_data::children_pending(const size_t& node) const {
+			_d->check(node);
+			return _d->_nodes[node].children_pending;
+		}
+
+		tree_data& tree_data::children_pending(const size_t& node, const bool& children_pending) {
+			_d->check(node);
+
+			if (_d->_nodes[node].children_pending != children_pending)
+				modify()._nodes[node].children_pending = children_pending;
+
+			return *this;
+		}
+
+		void tree_data::remove_children(const size_t& node) {
+			auto& d = modify();
+			auto& p = d.get(node);
+
+			// free the descendants, depth first
+			std::vector<std::uint32_t> stack;
+			for (auto child = p.first_child; child != impl::nil; child = d._nodes[child].next_sibling)
+				stack.push_back(child);
+
+			while (!stack.empty()) {
+				const auto handle = stack.back();
+				stack.pop_back();
+
+				for (auto child = d._nodes[handle].first_child; child != impl::nil; child = d._nodes[child].next_sibling)
+					stack.push_back(child);
+
+				d.release(d._nodes[handle].name);
+				d._nodes[handle] = impl::node();
+				d._nodes[handle].removed = true;
+				d._free.push_back(handle);
+			}
+
+			p.first_child = impl::nil;
+			p.last_child = impl::nil;
+		}
+
+		bool tree_data::loaded(const size_t& node) const {
+			_d->check(node);
+			return _d->_nodes[node].loaded;
+		}
+
+		tree_data& tree_data::loaded(const size_t& node, const bool& loaded) {
+			_d->check(node);
+
+			if (_d->_nodes[node].loaded != loaded)
+				modify()._nodes[node].loaded = loaded;
+
+			return *this;
+		}
+
+		void tree_data::sort(const size_t& node,
+			const std::function<bool(const std::string&, const std::string&)>& less) {
+			auto& d = modify();
+			auto& p = d.get(node);
+
+			std::vector<std::uint32_t> children;
+			for (auto child = p.first_child; child != impl::nil; child = d._nodes[child].next_sibling)
+				children.push_back(child);
+
+			std::stable_sort(children.begin(), children.end(),
+				[&](const std::uint32_t& a, const std::uint32_t& b) {
+					return less(d._strings[d._nodes[a].name], d._strings[d._nodes[b].name]);
+				});
+
+			// relink the children in their new order
+			p.first_child = impl::nil;
+			p.last_child = impl::nil;
+
+			for (const auto& child : children) {
+				if (p.last_child == impl::nil)
+					p.first_child = child;
+				else
+					d._nodes[p.last_child].next_sibling = child;
+
+				p.last_child = child;
+			}
+
+			if (p.last_child != impl::nil)
+				d._nodes[p.last_child].next_sibling = impl::nil;
+		}
+	}
+}
@@ -50,6 +50,10 @@ namespace liblec {
 			_corner_radius_x = right._corner_radius_x;
 			_corner_radius_y = right._corner_radius_y;
 			_root = right._root;
+			_node_data = right._node_data;
+			_use_node_data = right._use_node_data;
+			_unload_on_collapse = right._unload_on_collapse;
+			_root_generation = right._root_generation;
 
 			// NOT copied (_alias, _p_special_pane_specs)
 
@@ -106,35 +110,41 @@ namespace liblec {
 			return *this;
 		}
 
-		widgets::widget::cursor_type& widgets::tree_view::cursor() { return _cursor; }
+		widgets::widget::cursor_type& widgets::tree_view::cursor() { _generation++; return _cursor; }
 
 		widgets::tree_view& widgets::tree_view::cursor(const cursor_type cursor) {
 			_cursor = cursor;
+			_generation++;
 			return *this;
 		}
 
-		std::string& widgets::tree_view::font() { return _font; }
+		std::string& widgets::tree_view::font() { _generation++; return _font; }
 
 		widgets::tree_view& widgets::tree_view::font(const std::string& font) {
 			_font = font;
+			_generation++;
 			return *this;
 		}
 
-		float& widgets::tree_view::font_size() { return _font_size; }
+		float& widgets::tree_view::font_size() { _generation++; return _font_size; }
 
 		widgets::tree_view& widgets::tree_view::font_size(const float& font_size) {
 			_font_size = font_size;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::tree_view::color_text() { return _color_text; }
+		color& widgets::tree_view::color_text() { _generation++; return _color_text; }
 
 		widgets::tree_view& widgets::tree_view::color_text(const color& color_text) {
 			_color_text = color_text;
+			_generation++;
 			return *this;
 		}
 
 		color& widgets::tree_view::color_fill() {
+			_generation++;
+
 			if (_p_special_pane_specs)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane_specs*>(_p_special_pane_specs)->color_fill();
 			else
@@ -147,27 +157,31 @@ namespace liblec {
 			else
 				_color_fill = color_fill;
 
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::tree_view::color_hot() { return _color_hot; }
+		color& widgets::tree_view::color_hot() { _generation++; return _color_hot; }
 
 		widgets::tree_view& widgets::tree_view::color_hot(const color& color_hot) {
 			_color_hot = color_hot;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::tree_view::color_selected() { return _color_selected; }
+		color& widgets::tree_view::color_selected() { _generation++; return _color_selected; }
 
 		widgets::tree_view& widgets::tree_view::color_selected(const color& color_selected) {
 			_color_selected = color_selected;
+			_generation++;
 			return *this;
 		}
 
-		color& widgets::tree_view::color_disabled() { return _color_disabled; }
+		color& widgets::tree_view::color_disabled() { _generation++; return _color_disabled; }
 
 		widgets::tree_view& widgets::tree_view::color_disabled(const color& color_disabled) {
 			_color_disabled = color_disabled;
+			_generation++;
 			return *this;
 		}
 
@@ -188,6 +202,8 @@ namespace liblec {
 		}
 
 		lecui::color& widgets::tree_view::color_border() {
+			_generation++;
+
 			if (_p_special_pane_specs)	// redirect to special pane
 				return reinterpret_cast<lecui::containers::pane_specs*>(_p_special_pane_specs)->color_border();
 			else
@@ -200,6 +216,7 @@ namespace liblec {
 			else
 				_color_border = color_border;
 
+			_generation++;
 			return *this;
 		}
 
@@ -217,10 +234,31 @@ namespace liblec {
 			return *this;
 		}
 
-		std::map<std::string, widgets::tree_view::node>& widgets::tree_view::root() { return _root; }
+		std::map<std::string, widgets::tree_view::node>& widgets::tree_view::root() { _root_generation++; return _root; }
 
 		widgets::tree_view& widgets::tree_view::root(const std::map<std::string, widgets::tree_view::node>& root) {
 			_root = root;
+			_root_generation++;
+			return *this;
+		}
+
+		bool& widgets::tree_view::unload_on_collapse() { return _unload_on_collapse; }
+
+		widgets::tree_view& widgets::tree_view::unload_on_collapse(const bool& unload_on_collapse) {
+			_unload_on_collapse = unload_on_collapse;
+			return *this;
+		}
+
+		lecui::tree_data& widgets::tree_view::node_data() {
+			_use_node_data = true;
+			_root_generation++;
+			return _node_data;
+		}
+
+		widgets::tree_view& widgets::tree_view::node_data(const lecui::tree_data& node_data) {
+			_node_data = node_data;
+			_use_node_data = true;
+			_root_generation++;
 			return *this;
 		}
 
@@ -313,26 +351,12 @@ namespace liblec {
 
 		widgets::tree_view&
 			widgets::tree_view_builder::specs(form& fm, const std::string& path) {
-			const auto idx = path.find("/");
-
-			if (idx != std::string::npos) {
-				const auto page_alias = path.substr(0, idx);
-				const auto path_remaining = path.substr(idx + 1);
-				try {
-					// check form pages
-					auto& page = fm._d._p_pages.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_tree_view_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
-				try {
-					// check status panes
-					auto& page = fm._d._p_status_panes.at(page_alias);
-					auto results = fm._d.find_widget(page, path_remaining);
-					return results.page._d_page.get_tree_view_impl(results.widget.alias()).specs();
-				}
-				catch (const std::exception&) {}
+			try {
+				// check the form's pages and status panes
+				auto results = fm._d.find_widget(path);
+				return results.page._d_page.get_tree_view_impl(results.widget.alias()).specs();
 			}
+			catch (const std::exception&) {}
 
 			throw std::invalid_argument("Invalid path");
 		}
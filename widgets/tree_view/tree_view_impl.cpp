@@ -12,6 +12,7 @@
 #include "../label/label_impl.h"
 #include "../../form_impl/form_impl.h"
 #include "../../containers/page/page_impl.h"
+#include <algorithm>
 
 namespace liblec {
 	namespace lecui {
@@ -28,7 +29,12 @@ namespace liblec {
 			_p_direct2d_factory(p_direct2d_factory),
 			_p_directwrite_factory(p_directwrite_factory),
 			_p_text_layout(nullptr),
-			_margin(0.f)	// the tree will be moved into a special tree pane. The pane will have a margin!
+			_margin(0.f),	// the tree will be moved into a special tree pane. The pane will have a margin!
+			_root_generation(0),
+			_rows_changed(true),
+			_selected_node(lecui::tree_data::none),
+			_width(0.f),
+			_height(0.f)
 		{}
 
 		widgets::tree_view_impl::~tree_view_impl() { discard_resources(); }
@@ -40,7 +46,6 @@ namespace liblec {
 
 		HRESULT widgets::tree_view_impl::create_resources(
 			ID2D1HwndRenderTarget* p_render_target) {
-			_specs_old = _specs;
 			_is_static = false;
 			_h_cursor = get_cursor(_specs.cursor());
 
@@ -88,14 +93,17 @@ namespace liblec {
 			safe_release(&_p_brush_disabled);
 			safe_release(&_p_brush_selected);
 			safe_release(&_p_text_format);
+
+			// the font may have changed
+			_text_extents.clear();
+			_rows_changed = true;
 		}
 
 		D2D1_RECT_F&
 			widgets::tree_view_impl::render(ID2D1HwndRenderTarget* p_render_target,
 				const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset, const bool& render) {
-			if (_specs_old != _specs) {
+			if (specs_changed()) {
 				log("specs changed: " + _alias);
-				_specs_old = _specs;
 
 				try {
 					if (_tree_pane_specs.has_value()) {
@@ -112,6 +120,9 @@ namespace liblec {
 				discard_resources();
 			}
 
+			// reading the specs while rendering is not a change
+			specs_generation_guard guard(*this);
+
 			if (!_resources_created)
 				create_resources(p_render_target);
 
@@ -125,243 +136,230 @@ namespace liblec {
 			if (!render || !_visible)
 				return _rect;
 
-			class helper {
-			public:
-				static void draw_level(ID2D1Factory* p_direct2d_factory,
-					ID2D1HwndRenderTarget* p_render_target, IDWriteFactory* p_directwrite_factory,
-					IDWriteTextFormat* _p_text_format, ID2D1SolidColorBrush* p_brush,
-					ID2D1SolidColorBrush* p_brush_selected, ID2D1SolidColorBrush* _p_brush_hot,
-					const std::string& font, const float& font_size, std::map<std::string,
-					widgets::tree_view::node>& level, const D2D1_RECT_F& rect,
-					float& _right, float& _bottom, float& _optimized_right, float& _optimized_bottom, bool _hit, D2D1_POINT_2F _point,
-					float _dpi_scale) {
-					float bottom = rect.top;
-					float right = rect.right;
-
-					auto rect_node = rect;
-					rect_node.left += 10.f;
-					rect_node.right += 10.f;
-
-					for (auto& node : level) {
-						const bool has_children = !node.second.children.empty();
-
-						rect_node.top = bottom;
-						rect_node.bottom = rect_node.top + 20.f;
-						rect_node = widgets::measure_text(p_directwrite_factory, node.first,
-							font, font_size, text_alignment::left, paragraph_alignment::middle, true, false, rect_node);
-						rect_node.right += 1.f;	// failsafe to prevent occasional ellipses when scrolling horizontally
-
-						// capture node rectangle
-						node.second.rc = convert_rect(rect_node);
-
-						// capture optimized dimensions
-						_optimized_right = largest(_optimized_right, rect_node.right);
-						_optimized_bottom = largest(_optimized_bottom, rect_node.bottom);
-
-						right = largest(right, rect_node.right);
-						bottom = largest(bottom, rect_node.bottom);
-
-						// make adjustments to global trackers
-						_right = largest(_right, right);
-						_bottom = largest(_bottom, bottom);
-
-						D2D1_RECT_F rect_marker = { 0.f, 0.f, 0.f, 0.f };
-						if (has_children) {
-							// draw marker
-							D2D1_RECT_F rect_marker_ref = rect_node;
-							rect_marker_ref.left = rect.left;
-							rect_marker_ref.right = rect_node.left;
-
-							rect_marker = rect_marker_ref;
-							rect_marker.bottom = rect_marker.top + 10.f;
-							rect_marker.right = rect_marker.left + 10.f;
-
-							pos_rect(rect_marker_ref, rect_marker, 50.f, 50.f);
-
-							const float side = 10.f;
-
-							HRESULT hr = S_OK;
-							ID2D1PathGeometry* p_checkbox_geometry = nullptr;
-							hr = p_direct2d_factory->CreatePathGeometry(&p_checkbox_geometry);
-
-							if (SUCCEEDED(hr)) {
-								ID2D1GeometrySink* p_sink = nullptr;
-								hr = p_checkbox_geometry->Open(&p_sink);
-								if (SUCCEEDED(hr)) {
-									p_sink->SetFillMode(D2D1_FILL_MODE_WINDING);
-
-									/// Marker shapes designed using a square of size 10x10
-									if (node.second.expand) {
-										///            (8,2)
-										///          / |
-										///        /   |
-										///      /     |
-										///    /       |
-										///   ---------
-										/// (2,8)      (8,8)
-										/// 
-										p_sink->BeginFigure(
-											/// (2,8)
-											D2D1::Point2F(rect_marker.left + (.2f * side), rect_marker.top + (.8f * side)),
-											D2D1_FIGURE_BEGIN_FILLED
-											);
-										D2D1_POINT_2F points[] = {
-											/// (8,2)
-											D2D1::Point2F(rect_marker.left + (.8f * side), rect_marker.top + (.2f * side)),
-											/// (8,8)
-											D2D1::Point2F(rect_marker.left + (.8f * side), rect_marker.top + (.8f * side)),
-										};
-										p_sink->AddLines(points, ARRAYSIZE(points));
-									}
-									else {
-										///  (3,1)
-										///  | \
-										///  |   \
-										///  |     \ (7,5)
-										///  |     /
-										///  |   /
-										///  | /
-										///  (3,9)
-										/// 
-										p_sink->BeginFigure(
-											/// (3,1)
-											D2D1::Point2F(rect_marker.left + (.3f * side), rect_marker.top + (.1f * side)),
-											D2D1_FIGURE_BEGIN_FILLED
-											);
-										D2D1_POINT_2F points[] = {
-											/// (7,5)
-											D2D1::Point2F(rect_marker.left + (.7f * side), rect_marker.top + (.5f * side)),
-											/// (3,9)
-											D2D1::Point2F(rect_marker.left + (.3f * side), rect_marker.top + (.9f * side)),
-										};
-										p_sink->AddLines(points, ARRAYSIZE(points));
-									}
-
-									p_sink->EndFigure(D2D1_FIGURE_END_CLOSED);
-									hr = p_sink->Close();
-									safe_release(&p_sink);
-								}
-
-								// draw the geometry
-								p_render_target->FillGeometry(p_checkbox_geometry, p_brush);
-								safe_release(&p_checkbox_geometry);
-							}
-						}
+			sync_rows();
 
-						// capture marker rectangle
-						node.second.rc_expand = convert_rect(rect_marker);
+			auto offset_rect = [&](D2D1_RECT_F rect) {
+				rect.left += _rect.left;
+				rect.right += _rect.left;
+				rect.top += _rect.top;
+				rect.bottom += _rect.top;
+				return rect;
+			};
 
-						// check if mouse is in rect
-						if (_hit) {
-							auto rc = rect_node;
-							scale_RECT(rc, _dpi_scale);
+			// the row under the mouse
+			size_t hot_row = 0;
+			const bool row_hot = _hit && row_at(_point, hot_row);
 
-							// handle hit status
-							bool hot = false;
-							if (
-								_point.x >= rc.left && _point.x <= rc.right &&
-								_point.y >= rc.top && _point.y <= rc.bottom)
-								hot = true;
-							else
-								hot = false;
+			// draw only the rows that can be seen, starting with the first one that ends below the
+			// top of the visible area
+			const auto rect_page = _page._d_page.get_rect();
 
-							if (hot)
-								p_render_target->FillRectangle(rect_node, _p_brush_hot);
-						}
+			auto it = std::upper_bound(_rows.begin(), _rows.end(), rect_page.top - _rect.top,
+				[](const float& y, const tree_row& row) { return y < row.rect.bottom; });
 
-						if (node.second.selected) {
-							p_render_target->FillRectangle(rect_node, p_brush_selected);
-						}
+			for (; it != _rows.end() && it->rect.top + _rect.top <= rect_page.bottom; it++) {
+				const auto& row = *it;
 
-						// create a text layout
-						IDWriteTextLayout* _p_text_layout = nullptr;
-						HRESULT hr = p_directwrite_factory->CreateTextLayout(convert_string(node.first).c_str(),
-							(UINT32)node.first.length(), _p_text_format, rect_node.right - rect_node.left,
-							rect_node.bottom - rect_node.top, &_p_text_layout);
+				// look the node up, it may have been removed since the rows were laid out
+				bool selected = false;
+				const std::string* p_name = nullptr;
 
-						if (SUCCEEDED(hr)) {
-							// draw the text layout
-							p_render_target->DrawTextLayout(D2D1_POINT_2F{ rect_node.left, rect_node.top },
-								_p_text_layout, p_brush, D2D1_DRAW_TEXT_OPTIONS_CLIP);
-						}
+				if (row.handle != lecui::tree_data::none) {
+					if (_specs._node_data.contains(row.handle)) {
+						selected = row.handle == _selected_node;
+						p_name = &_specs._node_data.name(row.handle);
+					}
+				}
+				else {
+					auto p_node = row_node(static_cast<size_t>(it - _rows.begin()));
+
+					if (p_node) {
+						selected = p_node->selected;
+						p_name = &row.key;
+					}
+				}
 
-						// release the text layout
-						safe_release(&_p_text_layout);
+				if (!p_name) {
+					// lay the rows out again
+					_rows_changed = true;
+					_page._d_page.get_form()._d._schedule_refresh = true;
+					continue;
+				}
 
-						bottom = rect_node.bottom;
+				const auto& name = *p_name;
+				const auto rect_node = offset_rect(row.rect);
 
-						if (node.second.expand && has_children) {
-							auto rect_child = rect_node;
-							rect_child.top = rect_node.bottom;
-							rect_child.bottom = rect_child.top + 20.f;
-							rect_child.left += 10.f;
-							rect_child.right += 10.f;
+				if (row.has_children) {
+					// draw marker
+					const auto rect_marker = offset_rect(marker_rect(row));
+					const float side = 10.f;
 
-							draw_level(p_direct2d_factory, p_render_target, p_directwrite_factory,
-								_p_text_format, p_brush, p_brush_selected, _p_brush_hot, font,
-								font_size, node.second.children, rect_child, _right, _bottom,
-								_optimized_right, _optimized_bottom, _hit, _point, _dpi_scale);	// recursion
+					HRESULT hr = S_OK;
+					ID2D1PathGeometry* p_checkbox_geometry = nullptr;
+					hr = _p_direct2d_factory->CreatePathGeometry(&p_checkbox_geometry);
 
-							right = largest(right, _right);
-							bottom = largest(bottom, _bottom);
+					if (SUCCEEDED(hr)) {
+						ID2D1GeometrySink* p_sink = nullptr;
+						hr = p_checkbox_geometry->Open(&p_sink);
+						if (SUCCEEDED(hr)) {
+							p_sink->SetFillMode(D2D1_FILL_MODE_WINDING);
+
+							/// Marker shapes designed using a square of size 10x10
+							if (row.expand) {
+								///            (8,2)
+								///          / |
+								///        /   |
+								///      /     |
+								///    /       |
+								///   ---------
+								/// (2,8)      (8,8)
+								/// 
+								p_sink->BeginFigure(
+									/// (2,8)
+									D2D1::Point2F(rect_marker.left + (.2f * side), rect_marker.top + (.8f * side)),
+									D2D1_FIGURE_BEGIN_FILLED
+									);
+								D2D1_POINT_2F points[] = {
+									/// (8,2)
+									D2D1::Point2F(rect_marker.left + (.8f * side), rect_marker.top + (.2f * side)),
+									/// (8,8)
+									D2D1::Point2F(rect_marker.left + (.8f * side), rect_marker.top + (.8f * side)),
+								};
+								p_sink->AddLines(points, ARRAYSIZE(points));
+							}
+							else {
+								///  (3,1)
+								///  | \
+								///  |   \
+								///  |     \ (7,5)
+								///  |     /
+								///  |   /
+								///  | /
+								///  (3,9)
+								/// 
+								p_sink->BeginFigure(
+									/// (3,1)
+									D2D1::Point2F(rect_marker.left + (.3f * side), rect_marker.top + (.1f * side)),
+									D2D1_FIGURE_BEGIN_FILLED
+									);
+								D2D1_POINT_2F points[] = {
+									/// (7,5)
+									D2D1::Point2F(rect_marker.left + (.7f * side), rect_marker.top + (.5f * side)),
+									/// (3,9)
+									D2D1::Point2F(rect_marker.left + (.3f * side), rect_marker.top + (.9f * side)),
+								};
+								p_sink->AddLines(points, ARRAYSIZE(points));
+							}
+
+							p_sink->EndFigure(D2D1_FIGURE_END_CLOSED);
+							hr = p_sink->Close();
+							safe_release(&p_sink);
 						}
+
+						// draw the geometry
+						p_render_target->FillGeometry(p_checkbox_geometry, _p_brush);
+						safe_release(&p_checkbox_geometry);
 					}
+				}
+
+				// check if mouse is in rect
+				if (row_hot && static_cast<size_t>(it - _rows.begin()) == hot_row) {
+					auto rc = rect_node;
+					scale_RECT(rc, get_dpi_scale());
 
+					if (_point.x >= rc.left && _point.x <= rc.right)
+						p_render_target->FillRectangle(rect_node, _p_brush_hot);
 				}
-			};
 
-			// draw the tree
-			auto _right = _rect.right;
-			auto _bottom = _rect.top + 20;
-			auto _optimized_right = 0.f;
-			auto _optimized_bottom = 0.f;
-			helper::draw_level(_p_direct2d_factory, p_render_target, _p_directwrite_factory,
-				_p_text_format, _p_brush, _p_brush_selected, _p_brush_hot, _specs.font(),
-				_specs.font_size(), _specs.root(), _rect, _right, _bottom, _optimized_right,
-				_optimized_bottom, _hit, _point, get_dpi_scale());
+				if (selected)
+					p_render_target->FillRectangle(rect_node, _p_brush_selected);
+
+				// create a text layout
+				HRESULT hr = _p_directwrite_factory->CreateTextLayout(convert_string(name).c_str(),
+					(UINT32)name.length(), _p_text_format, rect_node.right - rect_node.left,
+					rect_node.bottom - rect_node.top, &_p_text_layout);
 
-			const auto width = _optimized_right - _rect.left;
-			const auto height = _optimized_bottom - _rect.top;
+				if (SUCCEEDED(hr)) {
+					// draw the text layout
+					p_render_target->DrawTextLayout(D2D1_POINT_2F{ rect_node.left, rect_node.top },
+						_p_text_layout, _p_brush, D2D1_DRAW_TEXT_OPTIONS_CLIP);
+				}
+
+				// release the text layout
+				safe_release(&_p_text_layout);
+			}
 
 			// update widget rect
 			// use _specs._rect not _specs.rect() due to redirection to special pane
-			_specs._rect.width(width);
-			_specs._rect.height(height);
+			_specs._rect.width(_width);
+			_specs._rect.height(_height);
 
 			return _rect;
 		}
 
 		void widgets::tree_view_impl::on_click() {
-			class helper {
-			public:
-				static void check(std::map<std::string, widgets::tree_view::node>& level, D2D1_POINT_2F _point, float _dpi_scale) {
-					for (auto& node : level) {
-						// check if marker has been clicked
-						auto rect_marker = convert_rect(node.second.rc_expand);
-						auto rect_node = convert_rect(node.second.rc);
-						scale_RECT(rect_marker, _dpi_scale);
-						scale_RECT(rect_node, _dpi_scale);
-
-						if (_point.x >= rect_marker.left && _point.x <= rect_marker.right &&
-							_point.y >= rect_marker.top && _point.y <= rect_marker.bottom)
-							node.second.expand = !node.second.expand;
-
-						if (_point.x >= rect_node.left && _point.x <= rect_node.right &&
-							_point.y >= rect_node.top && _point.y <= rect_node.bottom)
-							node.second.selected = true;
+			sync_rows();
+
+			// clear the selection
+			if (!_selected_path.empty()) {
+				auto p_selected = find_node(_selected_path);
+
+				if (p_selected)
+					p_selected->selected = false;
+
+				_selected_path.clear();
+			}
+
+			_selected_node = lecui::tree_data::none;
+
+			size_t index = 0;
+
+			if (row_at(_point, index)) {
+				const auto& row = _rows[index];
+				const float x = _point.x / get_dpi_scale() - _rect.left;
+
+				// look the node up, it may have been removed since the rows were laid out
+				auto p_node = row.handle == lecui::tree_data::none ? row_node(index) : nullptr;
+				const bool exists = row.handle == lecui::tree_data::none ?
+					p_node != nullptr : _specs._node_data.contains(row.handle);
+
+				if (!exists)
+					_rows_changed = true;	// lay the rows out again
+				else {
+					// mark selected ... before the expand event, which may remove the node
+					if (x >= row.rect.left && x <= row.rect.right) {
+						if (p_node) {
+							p_node->selected = true;
+							_selected_path = row_path(index);
+						}
 						else
-							node.second.selected = false;
+							_selected_node = row.handle;
+					}
+
+					// check if marker has been clicked
+					const auto rect_marker = marker_rect(row);
 
-						check(node.second.children, _point, _dpi_scale);	// recursion
+					if (row.has_children && x >= rect_marker.left && x <= rect_marker.right) {
+						if (p_node) {
+							if (row.expand)
+								collapse(*p_node);
+							else
+								expand(*p_node);
+						}
+						else {
+							if (row.expand)
+								collapse(row.handle);
+							else
+								expand(row.handle);
+						}
+
+						_rows_changed = true;
 					}
 				}
-			};
-
-			// mark selected
-			helper::check(_specs.root(), _point, get_dpi_scale());
+			}
 
 			// handle on_selection
-			if (_specs.events().selection)
+			if (_specs.events().selection || _specs.events().node_data_selection)
 				on_selection();
 
 			// handle on_click
@@ -400,22 +398,264 @@ namespace liblec {
 		}
 
 		void widgets::tree_view_impl::on_selection() {
-			class helper {
-			public:
-				static void check(std::map<std::string, widgets::tree_view::node>& level,
-					std::function<void(widgets::tree_view::node& n)> selection) {
-					for (auto& node : level) {
-						if (node.second.selected) {
-							if (selection)
-								selection(node.second);
+			if (!_selected_path.empty() && _specs.events().selection) {
+				auto p_selected = find_node(_selected_path);
+
+				if (p_selected)
+					_specs.events().selection(*p_selected);
+			}
+
+			if (_selected_node != lecui::tree_data::none && _specs.events().node_data_selection)
+				_specs.events().node_data_selection(_selected_node);
+		}
+
+		void widgets::tree_view_impl::expand(widgets::tree_view::node& node) {
+			node.expand = true;
+
+			if (_specs.events().expand) {
+				const bool pending = node.children_pending;
+				_specs.events().expand(node);
+
+				if (pending) {
+					node.children_pending = false;
+					node.loaded = true;
+				}
+			}
+		}
+
+		void widgets::tree_view_impl::collapse(widgets::tree_view::node& node) {
+			node.expand = false;
+
+			if (_specs._unload_on_collapse && node.loaded) {
+				// the selection has already been cleared, so none of the children is selected
+				node.children.clear();
+				node.children_pending = true;
+				node.loaded = false;
+			}
+		}
+
+		void widgets::tree_view_impl::expand(const size_t& node) {
+			auto& data = _specs._node_data;
+			data.expand(node, true);
+
+			if (_specs.events().node_data_expand) {
+				const bool pending = data.children_pending(node);
+				_specs.events().node_data_expand(node);
+
+				if (pending) {
+					data.children_pending(node, false);
+					data.loaded(node, true);
+				}
+			}
+		}
+
+		void widgets::tree_view_impl::collapse(const size_t& node) {
+			auto& data = _specs._node_data;
+			data.expand(node, false);
+
+			if (_specs._unload_on_collapse && data.loaded(node)) {
+				// the selection has already been cleared, so no handles of the children remain
+				data.remove_children(node);
+				data.children_pending(node, true);
+				data.loaded(node, false);
+			}
+		}
+
+		void widgets::tree_view_impl::sync_rows() {
+			if (_root_generation != _specs._root_generation) {
+				// nodes may have been added, removed, expanded or collapsed through root(), so
+				// look for the selected node again
+				class helper {
+				public:
+					static bool find_selected(
+						std::map<std::string, widgets::tree_view::node>& level,
+						std::vector<std::string>& path) {
+						for (auto& node : level) {
+							path.push_back(node.first);
+
+							if (node.second.selected)
+								return true;
+
+							if (find_selected(node.second.children, path))	// recursion
+								return true;
+
+							path.pop_back();
 						}
-						else
-							check(node.second.children, selection);	// recursion
+
+						return false;
 					}
-				}
+				};
+
+				_selected_path.clear();
+				helper::find_selected(_specs._root, _selected_path);
+
+				// handles go away when nodes are removed or the tree data is cleared
+				if (_selected_node != lecui::tree_data::none && !_specs._node_data.contains(_selected_node))
+					_selected_node = lecui::tree_data::none;
+
+				_root_generation = _specs._root_generation;
+				_rows_changed = true;
+			}
+
+			if (!_rows_changed)
+				return;
+
+			_rows.clear();
+			_width = 0.f;
+			_height = 0.f;
+
+			float bottom = 0.f;
+
+			if (_specs._use_node_data)
+				add_rows(lecui::tree_data::none, 0.f, bottom);
+			else
+				add_rows(_specs._root, no_row, 0.f, bottom);
+
+			_rows_changed = false;
+		}
+
+		void widgets::tree_view_impl::add_rows(std::map<std::string, widgets::tree_view::node>& level,
+			const size_t& parent, const float& level_left, float& bottom) {
+			for (auto& node : level) {
+				auto& row = add_row(node.first, level_left, bottom);
+				row.parent = parent;
+				row.key = node.first;
+				row.has_children = !node.second.children.empty() || node.second.children_pending;
+				row.expand = node.second.expand;
+
+				if (row.expand && row.has_children)
+					add_rows(node.second.children, _rows.size() - 1, row.rect.left + 10.f, bottom);	// recursion
+			}
+		}
+
+		void widgets::tree_view_impl::add_rows(const size_t& parent, const float& level_left, float& bottom) {
+			const auto& data = _specs._node_data;
+
+			for (auto node = data.first_child(parent); node != lecui::tree_data::none; node = data.next_sibling(node)) {
+				auto& row = add_row(data.name(node), level_left, bottom);
+				row.handle = node;
+				row.has_children = data.first_child(node) != lecui::tree_data::none || data.children_pending(node);
+				row.expand = data.expand(node);
+
+				if (row.expand && row.has_children)
+					add_rows(node, row.rect.left + 10.f, bottom);	// recursion
+			}
+		}
+
+		widgets::tree_view_impl::tree_row&
+			widgets::tree_view_impl::add_row(const std::string& name, const float& level_left, float& bottom) {
+			// each node is placed in a 20px high slot that begins where the previous node ends
+			const auto& extent = text_extent(name);
+
+			tree_row row;
+			row.level_left = level_left;
+			row.rect = {
+				level_left + 10.f + extent.left,
+				bottom + extent.top,
+				level_left + 10.f + extent.right + 1.f,	// failsafe to prevent occasional ellipses when scrolling horizontally
+				bottom + extent.bottom
 			};
 
-			helper::check(_specs.root(), _specs.events().selection);
+			_width = largest(_width, row.rect.right);
+			_height = largest(_height, row.rect.bottom);
+			bottom = row.rect.bottom;
+
+			_rows.push_back(row);
+			return _rows.back();
+		}
+
+		const D2D1_RECT_F& widgets::tree_view_impl::text_extent(const std::string& name) {
+			auto it = _text_extents.find(name);
+
+			if (it == _text_extents.end()) {
+				// the width of the slot doesn't matter since the text is allowed to overflow it
+				const D2D1_RECT_F slot = { 0.f, 0.f, 100.f, 20.f };
+
+				it = _text_extents.emplace(name, widgets::measure_text(_p_directwrite_factory, name,
+					_specs.font(), _specs.font_size(), text_alignment::left, paragraph_alignment::middle,
+					true, false, slot)).first;
+			}
+
+			return it->second;
+		}
+
+		bool widgets::tree_view_impl::row_at(const D2D1_POINT_2F& point, size_t& row) {
+			// the point is in pixels and the rows are laid out in DIPs, relative to the tree
+			const float y = point.y / get_dpi_scale() - _rect.top;
+
+			// the first row that doesn't end above the point
+			auto it = std::lower_bound(_rows.begin(), _rows.end(), y,
+				[](const tree_row& row, const float& y) { return row.rect.bottom < y; });
+
+			if (it == _rows.end() || y < it->rect.top)
+				return false;
+
+			row = static_cast<size_t>(it - _rows.begin());
+			return true;
+		}
+
+		D2D1_RECT_F widgets::tree_view_impl::marker_rect(const tree_row& row) {
+			// centered in the space between the start of the level and the node
+			D2D1_RECT_F rect_marker_ref = row.rect;
+			rect_marker_ref.left = row.level_left;
+			rect_marker_ref.right = row.rect.left;
+
+			D2D1_RECT_F rect_marker = rect_marker_ref;
+			rect_marker.bottom = rect_marker.top + 10.f;
+			rect_marker.right = rect_marker.left + 10.f;
+
+			pos_rect(rect_marker_ref, rect_marker, 50.f, 50.f);
+			return rect_marker;
+		}
+
+		widgets::tree_view::node* widgets::tree_view_impl::row_node(size_t row) {
+			// the rows of the node and its parents, the node's first
+			std::vector<size_t> rows;
+
+			for (; row != no_row; row = _rows[row].parent)
+				rows.push_back(row);
+
+			auto p_level = &_specs._root;
+			widgets::tree_view::node* p_node = nullptr;
+
+			for (auto it = rows.rbegin(); it != rows.rend(); it++) {
+				auto node = p_level->find(_rows[*it].key);
+
+				if (node == p_level->end())
+					return nullptr;
+
+				p_node = &node->second;
+				p_level = &p_node->children;
+			}
+
+			return p_node;
+		}
+
+		std::vector<std::string> widgets::tree_view_impl::row_path(size_t row) {
+			std::vector<std::string> path;
+
+			for (; row != no_row; row = _rows[row].parent)
+				path.push_back(_rows[row].key);
+
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+
+		widgets::tree_view::node* widgets::tree_view_impl::find_node(const std::vector<std::string>& path) {
+			auto p_level = &_specs._root;
+			widgets::tree_view::node* p_node = nullptr;
+
+			for (const auto& key : path) {
+				auto node = p_level->find(key);
+
+				if (node == p_level->end())
+					return nullptr;
+
+				p_node = &node->second;
+				p_level = &p_node->children;
+			}
+
+			return p_node;
 		}
 	}
 }
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <optional>
+#include <unordered_map>
 #include "../widget_impl.h"
 #include "../tree_view.h"
 #include "../../containers/pane/pane_impl.h"
@@ -55,7 +56,7 @@ namespace liblec {
 				tree_view_impl& operator=(const tree_view_impl&) = delete;
 
 				/// Private variables
-				widgets::tree_view _specs, _specs_old;
+				widgets::tree_view _specs;
 				ID2D1SolidColorBrush* _p_brush;
 				ID2D1SolidColorBrush* _p_brush_hot;
 				ID2D1SolidColorBrush* _p_brush_disabled;
@@ -70,8 +71,45 @@ namespace liblec {
 
 				std::optional<std::reference_wrapper<containers::pane_specs>> _tree_pane_specs;
 
+				static constexpr size_t no_row = static_cast<size_t>(-1);
+
+				/// A node whose parents are all expanded, shown on a row of its own. The row only
+				/// keeps what it takes to look the node up, since the app can remove nodes at any time
+				struct tree_row {
+					size_t handle = lecui::tree_data::none;		// the node's handle in node data
+					size_t parent = no_row;		// the row of the node's parent, when shown from root()
+					std::string key;			// the node's key in its parent's children, when shown from root()
+					bool has_children = false;
+					bool expand = false;
+					float level_left = 0.f;		// where the node's level starts
+					D2D1_RECT_F rect = { 0.f, 0.f, 0.f, 0.f };	// relative to the top left of the tree
+				};
+
+				std::vector<tree_row> _rows;	// in the order they are shown
+				std::unordered_map<std::string, D2D1_RECT_F> _text_extents;	// measured once per name
+				unsigned long long _root_generation;
+				bool _rows_changed;	// a node has been expanded or collapsed
+				std::vector<std::string> _selected_path;	// the keys of the selected node in root(), top level first
+				size_t _selected_node;	// the selected node in node data
+				float _width, _height;
+
 				/// Private methods.
 				void on_selection();
+				void expand(widgets::tree_view::node& node);
+				void collapse(widgets::tree_view::node& node);
+				void expand(const size_t& node);
+				void collapse(const size_t& node);
+				void sync_rows();
+				void add_rows(std::map<std::string, widgets::tree_view::node>& level,
+					const size_t& parent, const float& level_left, float& bottom);
+				void add_rows(const size_t& parent, const float& level_left, float& bottom);
+				tree_row& add_row(const std::string& name, const float& level_left, float& bottom);
+				const D2D1_RECT_F& text_extent(const std::string& name);
+				bool row_at(const D2D1_POINT_2F& point, size_t& row);
+				D2D1_RECT_F marker_rect(const tree_row& row);
+				widgets::tree_view::node* row_node(size_t row);
+				std::vector<std::string> row_path(size_t row);
+				widgets::tree_view::node* find_node(const std::vector<std::string>& path);
 			};
 		}
 	}
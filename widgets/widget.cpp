@@ -123,6 +123,11 @@ namespace liblec {
 			}
 		}
 
+		widget_handle::widget_handle(const std::string& path) :
+			_path(path) {}
+
+		const std::string& widget_handle::path() const { return _path; }
+
 		class widget_manager::impl {
 		public:
 			impl(form& fm) :
@@ -137,19 +142,39 @@ namespace liblec {
 		}
 
 		bool widget_manager::enable(const std::string& path, std::string& error) {
-			return _d._fm._d.enable(path, true, error);
+			widget_handle handle(path);
+			return _d._fm._d.enable(handle, true, error);
+		}
+
+		bool widget_manager::enable(widget_handle& handle, std::string& error) {
+			return _d._fm._d.enable(handle, true, error);
 		}
 
 		bool widget_manager::disable(const std::string& path, std::string& error) {
-			return _d._fm._d.enable(path, false, error);
+			widget_handle handle(path);
+			return _d._fm._d.enable(handle, false, error);
+		}
+
+		bool widget_manager::disable(widget_handle& handle, std::string& error) {
+			return _d._fm._d.enable(handle, false, error);
 		}
 
 		bool widget_manager::show(const std::string& path, std::string& error) {
-			return _d._fm._d.show(path, true, error);
+			widget_handle handle(path);
+			return _d._fm._d.show(handle, true, error);
+		}
+
+		bool widget_manager::show(widget_handle& handle, std::string& error) {
+			return _d._fm._d.show(handle, true, error);
 		}
 
 		bool widget_manager::hide(const std::string& path, std::string& error) {
-			return _d._fm._d.show(path, false, error);
+			widget_handle handle(path);
+			return _d._fm._d.show(handle, false, error);
+		}
+
+		bool widget_manager::hide(widget_handle& handle, std::string& error) {
+			return _d._fm._d.show(handle, false, error);
 		}
 
 		void widget_manager::close(const std::string& path) {
@@ -168,11 +193,21 @@ namespace liblec {
 		}
 
 		void widget_manager::select(const std::string& path) {
-			_d._fm._d.select(path);
+			widget_handle handle(path);
+			_d._fm._d.select(handle);
+		}
+
+		void widget_manager::select(widget_handle& handle) {
+			_d._fm._d.select(handle);
 		}
 
 		bool widget_manager::refresh(const std::string& path, std::string& error) {
-			return _d._fm._d.refresh(path, error);
+			widget_handle handle(path);
+			return _d._fm._d.refresh(handle, error);
+		}
+
+		bool widget_manager::refresh(widget_handle& handle, std::string& error) {
+			return _d._fm._d.refresh(handle, error);
 		}
 	}
 }
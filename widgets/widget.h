@@ -49,6 +49,11 @@ namespace liblec {
 				color _color_selected = { 0, 120, 170, 30 };			///< The color to indicate when the widget is selected.
 				color _color_disabled = { 180, 180, 180, 255 };			///< The color to indicate when the widget is disabled.
 
+				/// <summary>The change generation of the widget. Incremented whenever a property
+				/// that requires the widget's resources to be re-created is set, or its reference is
+				/// handed out by a getter.</summary>
+				unsigned long long _generation = 0;
+
 			public:
 				/// <summary>Widget constructor.</summary>
 				widget() {};
@@ -162,6 +167,7 @@ namespace liblec {
 
 #if defined(LECUI_EXPORTS)
 				friend class containers::page;
+				friend class widget_impl;
 
 				// implementation classes for widgets that use special panes ... they need access to private variables for redirection
 				friend class table_view_impl;
@@ -314,6 +320,36 @@ namespace liblec {
 			};
 		}
 
+		namespace widgets {
+			class widget_impl;
+		}
+
+		/// <summary>A widget path that is looked up once and then reused.</summary>
+		/// <remarks>Pass this to the widget manager in place of the path when the same widget is
+		/// managed often, e.g. when it is updated from a data feed, to skip looking up the path on
+		/// every call. The path is only looked up again after a widget in the form has been closed.
+		/// </remarks>
+		class lecui_api widget_handle {
+		public:
+			/// <summary>Widget handle constructor.</summary>
+			/// <param name="path">The full path to the widget, e.g. "home_page/username".</param>
+			widget_handle(const std::string& path);
+
+			/// <summary>Get the full path to the widget.</summary>
+			/// <returns>The path.</returns>
+			const std::string& path() const;
+
+		private:
+			std::string _path;
+			widgets::widget_impl* _p_widget = nullptr;
+			containers::page* _p_page = nullptr;
+			unsigned long long _generation = 0;	// of the form's widget index when looked up
+
+#if defined(LECUI_EXPORTS)
+			friend class form;
+#endif
+		};
+
 		/// <summary>Widget manager class.</summary>
 		class lecui_api widget_manager {
 		public:
@@ -332,6 +368,12 @@ namespace liblec {
 			/// it sends this call internally.</remarks>
 			bool enable(const std::string& path, std::string& error);
 
+			/// <summary>Enable a widget.</summary>
+			/// <param name="handle">The widget's handle.</param>
+			/// <param name="error">Error information.</param>
+			/// <returns>Returns true if successful, else false.</returns>
+			bool enable(widget_handle& handle, std::string& error);
+
 			/// <summary>Disable a widget.</summary>
 			/// <param name="path">The full path to the widget, e.g. "home_page/username".</param>
 			/// <param name="error">Error information.</param>
@@ -340,6 +382,12 @@ namespace liblec {
 			/// it sends this call internally.</remarks>
 			bool disable(const std::string& path, std::string& error);
 
+			/// <summary>Disable a widget.</summary>
+			/// <param name="handle">The widget's handle.</param>
+			/// <param name="error">Error information.</param>
+			/// <returns>Returns true if successful, else false.</returns>
+			bool disable(widget_handle& handle, std::string& error);
+
 			/// <summary>Show a widget.</summary>
 			/// <param name="path">The full path to the widget, e.g. "home_page/username".</param>
 			/// <param name="error">Error information.</param>
@@ -348,6 +396,12 @@ namespace liblec {
 			/// it sends this call internally.</remarks>
 			bool show(const std::string& path, std::string& error);
 
+			/// <summary>Show a widget.</summary>
+			/// <param name="handle">The widget's handle.</param>
+			/// <param name="error">Error information.</param>
+			/// <returns>Returns true if successful, else false.</returns>
+			bool show(widget_handle& handle, std::string& error);
+
 			/// <summary>Hide a widget.</summary>
 			/// <param name="path">The full path to the widget, e.g. "home_page/username".</param>
 			/// <param name="error">Error information.</param>
@@ -356,6 +410,12 @@ namespace liblec {
 			/// it sends this call internally.</remarks>
 			bool hide(const std::string& path, std::string& error);
 
+			/// <summary>Hide a widget.</summary>
+			/// <param name="handle">The widget's handle.</param>
+			/// <param name="error">Error information.</param>
+			/// <returns>Returns true if successful, else false.</returns>
+			bool hide(widget_handle& handle, std::string& error);
+
 			/// <summary>Close a widget.</summary>
 			/// <param name="path">The full path to the widget, e.g. "home_page/username".</param>
 			/// <remarks>Avoid closing a widget from within its own handler to avoid access
@@ -378,6 +438,10 @@ namespace liblec {
 			/// it sends this call internally.</remarks>
 			void select(const std::string& path);
 
+			/// <summary>Select a widget.</summary>
+			/// <param name="handle">The widget's handle.</param>
+			void select(widget_handle& handle);
+
 			/// <summary>Refresh a widget.</summary>
 			/// <param name="path">The full path to the widget, e.g. "home_page/username".</param>
 			/// <param name="error">Error information.</param>
@@ -391,6 +455,12 @@ namespace liblec {
 			/// it sends this call internally.</remarks>
 			bool refresh(const std::string& path, std::string& error);
 
+			/// <summary>Refresh a widget.</summary>
+			/// <param name="handle">The widget's handle.</param>
+			/// <param name="error">Error information.</param>
+			/// <returns>Returns true if successful, else false.</returns>
+			bool refresh(widget_handle& handle, std::string& error);
+
 		private:
 			class impl;
 			impl& _d;
@@ -29,7 +29,8 @@ namespace liblec {
 			_point_on_release({ 0.f,0.f }),
 			_resources_created(false),
 			_h_cursor(nullptr),
-			_tooltip_active(false) {}
+			_tooltip_active(false),
+			_specs_generation(0) {}
 
 		widgets::widget_impl::~widget_impl() {}
 
@@ -59,12 +60,20 @@ namespace liblec {
 			_hit = hit;
 
 			if (_hit) {
-				if (generic_specs().events().mouse_enter)
+				if (generic_specs().events().mouse_enter) {
 					generic_specs().events().mouse_enter();
+
+					// the handler may have changed any part of the form
+					get_form()._d.update();
+				}
 			}
 			else {
-				if (generic_specs().events().mouse_leave)
+				if (generic_specs().events().mouse_leave) {
 					generic_specs().events().mouse_leave();
+
+					// the handler may have changed any part of the form
+					get_form()._d.update();
+				}
 			}
 
 			return true;
@@ -102,6 +111,50 @@ namespace liblec {
 		HCURSOR widgets::widget_impl::cursor() { return _h_cursor; }
 		float widgets::widget_impl::get_dpi_scale() { return _page._d_page.get_dpi_scale(); }
 		form& widgets::widget_impl::get_form() { return _page._d_page.get_form(); }
+		void widgets::widget_impl::invalidate() { get_form()._d.update(_rect); }
+
+		bool widgets::widget_impl::specs_changed() {
+			return generic_specs()._generation != _specs_generation;
+		}
+
+		void widgets::widget_impl::record_specs_generation() {
+			_specs_generation = generic_specs()._generation;
+		}
+
+		const D2D1_RECT_F& widgets::widget_impl::measure(ID2D1HwndRenderTarget* p_render_target,
+			const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset) {
+			auto& specs = generic_specs();
+
+			if (_measurement.valid && bounds_from_specs() && !specs_changed() &&
+				_measurement.rect == specs._rect &&
+				_measurement.on_resize == specs._on_resize &&
+				_measurement.change_in_size.width == change_in_size.width &&
+				_measurement.change_in_size.height == change_in_size.height) {
+				// nothing the bounds depend on has changed, only move them by the offset
+				_rect = _measurement.bounds;
+				_rect.left -= offset.x;
+				_rect.right -= offset.x;
+				_rect.top -= offset.y;
+				_rect.bottom -= offset.y;
+				return _rect;
+			}
+
+			// render without drawing
+			const auto& rect = render(p_render_target, change_in_size, offset, false);
+
+			// render() may have changed the rect and resize parameters, e.g. to fit the contents
+			_measurement.valid = true;
+			_measurement.rect = specs._rect;
+			_measurement.on_resize = specs._on_resize;
+			_measurement.change_in_size = change_in_size;
+			_measurement.bounds = rect;
+			_measurement.bounds.left += offset.x;
+			_measurement.bounds.right += offset.x;
+			_measurement.bounds.top += offset.y;
+			_measurement.bounds.bottom += offset.y;
+
+			return rect;
+		}
 
 		void widgets::widget_impl::show_tooltip() {
 			// make a local copy of the tooltip text
@@ -289,6 +342,8 @@ namespace liblec {
 		bool widgets::widget_impl::on_mousewheel(float units) { return false; }
 		bool widgets::widget_impl::on_keydown(WPARAM wParam) { return false; }
 		void widgets::widget_impl::on_selection_change(const bool& selected) {}
+		void widgets::widget_impl::on_culled() {}
+		bool widgets::widget_impl::bounds_from_specs() { return true; }
 		bool widgets::widget_impl::contains() { return true; }
 
 		void widgets::widget_impl::select(const bool& selected) {
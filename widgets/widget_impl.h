@@ -209,6 +209,11 @@ namespace liblec {
 				void show_tooltip();
 				void hide_tooltip();
 
+				/// <summary>Schedule a redraw of the area covered by the widget.</summary>
+				/// <remarks>Use instead of form::update() when a change only affects the
+				/// widget's own appearance, e.g. on hover or when a caret blinks.</remarks>
+				void invalidate();
+
 				void create_badge_resources(badge_specs& badge,
 					ID2D1HwndRenderTarget* p_render_target,
 					IDWriteFactory* p_directwrite_factory,
@@ -245,6 +250,15 @@ namespace liblec {
 				virtual D2D1_RECT_F& render(ID2D1HwndRenderTarget* p_render_target,
 					const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset,
 					const bool& render) = 0;
+
+				/// <summary>Get the widget's bounds without drawing it.</summary>
+				/// <returns>The rect that render() would return for the same parameters.</returns>
+				/// <remarks>The last bounds are reused, moved by the offset, for as long as the
+				/// specs, the rect, the resize parameters and the change in size are the same.
+				/// Otherwise render() is called without drawing.</remarks>
+				const D2D1_RECT_F& measure(ID2D1HwndRenderTarget* p_render_target,
+					const D2D1_SIZE_F& change_in_size, const D2D1_POINT_2F& offset);
+
 				virtual void on_click();
 				virtual void on_right_click();
 				virtual void on_action();
@@ -252,12 +266,39 @@ namespace liblec {
 				virtual bool on_keydown(WPARAM wParam);
 				virtual void on_selection_change(const bool& selected);
 
+				/// <summary>Called instead of render() when the widget has been scrolled out of
+				/// view.</summary>
+				/// <remarks>Override to drop work that is only needed for drawing the widget.
+				/// </remarks>
+				virtual void on_culled();
+
 			protected:
 				D2D1_RECT_F position(const rect& rect,
 					const resize_params& on_resize,
 					const float& change_in_width,
 					const float& change_in_height);
 
+				/// <summary>Check whether the widget's specs have changed since the last render.
+				/// </summary>
+				/// <returns>True if a property that requires the widget's resources to be re-created
+				/// may have been changed, else false.</returns>
+				bool specs_changed();
+
+				/// <summary>Records the change generation of the widget's specs when a render ends.
+				/// </summary>
+				/// <remarks>The getters of the specs hand out references and therefore count as
+				/// changes. Declare one at the top of render(), right after checking
+				/// specs_changed(), so that the widget's own reads during the render are not
+				/// mistaken for changes in the next one.</remarks>
+				class specs_generation_guard {
+				public:
+					specs_generation_guard(widget_impl& widget) : _widget(widget) {}
+					~specs_generation_guard() { _widget.record_specs_generation(); }
+
+				private:
+					widget_impl& _widget;
+				};
+
 				/// <summary>For in-widget hit-testing of complex widgets. Called by default in
 				/// the public overload.</summary>
 				/// <returns>True if the point is over an essential area within the widget,
@@ -265,6 +306,13 @@ namespace liblec {
 				/// <remarks>Useful for complex widgets with multiple hit points.</remarks>
 				virtual bool contains();
 
+				/// <summary>Check whether the rect returned by render() follows from nothing but
+				/// the specs and the parameters of render(), so that measure() can reuse it.</summary>
+				/// <remarks>Override to return false for widgets whose bounds also depend on state
+				/// that isn't tracked by the specs' change generation, like the rows of a table.
+				/// </remarks>
+				virtual bool bounds_from_specs();
+
 				std::string _alias;
 				bool _is_static, _hit, _pressed, _right_pressed;
 				D2D1_RECT_F _rect;
@@ -288,6 +336,23 @@ namespace liblec {
 
 				std::string _tooltip_text;
 				bool _tooltip_active;
+
+			private:
+				void record_specs_generation();
+
+				/// <summary>The change generation of the widget's specs at the end of the last
+				/// render.</summary>
+				unsigned long long _specs_generation;
+
+				/// <summary>The bounds found by the last measurement, without the offset, and what
+				/// they were found from.</summary>
+				struct measurement {
+					bool valid = false;
+					lecui::rect rect;
+					resize_params on_resize;
+					D2D1_SIZE_F change_in_size = { 0.f, 0.f };
+					D2D1_RECT_F bounds = { 0.f, 0.f, 0.f, 0.f };
+				} _measurement;
 			};
 		}
 	}
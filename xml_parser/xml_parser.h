@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 /// <summary>A custom XML parser that describes the XML file based on positions of tags within
@@ -48,6 +49,14 @@ public:
 		/// <summary>The tag's attributes</summary>
 		std::vector<tag_attribute> attributes;
 
+		/// <summary>The number of tags, opening or closing, that precede the tag's opening tag
+		/// in the XML text. Only set by <see cref="read"></see>.</summary>
+		unsigned long open_tag = 0;
+
+		/// <summary>The number of tags, opening or closing, that precede the tag's closing tag
+		/// in the XML text. Only set by <see cref="read"></see>.</summary>
+		unsigned long close_tag = 0;
+
 		bool operator== (tag& t) {
 			if (level == t.level &&
 				name == t.name &&
@@ -78,7 +87,9 @@ public:
 	/// <param name="xml_text">XML text.</param>
 	/// <returns>Returns a description of the XML text using a xml_parser::xml data structure.
 	/// </returns>
-	xml read(std::string xml_text);
+	/// <remarks>The text is tokenized in a single forward pass, so the cost is linear in the
+	/// length of the text. Tags without a matching closing tag are dropped.</remarks>
+	xml read(std::string_view xml_text);
 
 	/// <summary>Write data from a xml_parser::xml structure to an XML string.</summary>
 	/// <param name="info">The description of the XML using the data structure.</param>
@@ -9,167 +9,324 @@
 //
 
 #include "xml_parser.h"
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/xml_parser.hpp>
-#include <algorithm>
+#include <unordered_map>
+
+/// <summary>An element that has been opened but whose closing tag is yet to be found.
+/// </summary>
+struct open_element {
+	/// <summary>The name of the element (a view into the xml text).</summary>
+	std::string_view name;
+
+	/// <summary>The attribute section of the start tag, e.g. style='color: red;'.</summary>
+	std::string_view attributes;
+
+	/// <summary>The position in the plaintext at which the element begins.</summary>
+	size_t start_position = 0;
+
+	/// <summary>The index of the element in document (opening) order.</summary>
+	size_t order = 0;
+
+	/// <summary>The number of tags before the element's opening tag.</summary>
+	size_t open_tag = 0;
+};
+
+/// <summary>An element whose closing tag has been found.</summary>
+struct closed_element {
+	bool matched = false;
+	std::string_view name;
+	std::string_view attributes;
+	size_t start_position = 0;
+	size_t end_position = 0;
+	size_t open_tag = 0;
+	size_t close_tag = 0;
+
+	/// <summary>The offset of the closing tag within the xml text. Used to establish nesting.
+	/// </summary>
+	size_t close_offset = 0;
+};
+
+void append_entity_decoded(std::string& out, std::string_view text) {
+	for (size_t i = 0; i < text.length(); i++) {
+		if (text[i] != '&') {
+			out += text[i];
+			continue;
+		}
 
-std::string get_plain(std::string xml_text) {
-	do {
-		const auto open = xml_text.find("<");
+		const auto semicolon = text.find(';', i);
 
-		if (open != std::string::npos) {
-			auto close = xml_text.find(">");
+		if (semicolon == std::string_view::npos) {
+			out += text[i];
+			continue;
+		}
 
-			if (close != std::string::npos)
-				xml_text.erase(open, close + 1 - open);
+		const auto entity = text.substr(i + 1, semicolon - (i + 1));
+
+		if (entity == "lt") out += '<';
+		else if (entity == "gt") out += '>';
+		else if (entity == "amp") out += '&';
+		else if (entity == "quot") out += '"';
+		else if (entity == "apos") out += '\'';
+		else if (entity.length() > 1 && entity[0] == '#') {
+			const bool hex = entity[1] == 'x' || entity[1] == 'X';
+			unsigned long code = 0;
+			bool valid = entity.length() > (hex ? 2U : 1U);
+
+			for (size_t j = hex ? 2 : 1; valid && j < entity.length(); j++) {
+				const auto c = entity[j];
+
+				if (c >= '0' && c <= '9')
+					code = code * (hex ? 16 : 10) + (c - '0');
+				else
+					if (hex && c >= 'a' && c <= 'f')
+						code = code * 16 + (c - 'a' + 10);
+					else
+						if (hex && c >= 'A' && c <= 'F')
+							code = code * 16 + (c - 'A' + 10);
+						else
+							valid = false;
+
+				if (code > 0x10FFFF)
+					valid = false;
+			}
+
+			if (!valid) {
+				out += text[i];
+				continue;
+			}
+
+			// write the code point as utf-8
+			if (code < 0x80)
+				out += static_cast<char>(code);
 			else
-				break;
+				if (code < 0x800) {
+					out += static_cast<char>(0xC0 | (code >> 6));
+					out += static_cast<char>(0x80 | (code & 0x3F));
+				}
+				else
+					if (code < 0x10000) {
+						out += static_cast<char>(0xE0 | (code >> 12));
+						out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+						out += static_cast<char>(0x80 | (code & 0x3F));
+					}
+					else {
+						out += static_cast<char>(0xF0 | (code >> 18));
+						out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+						out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+						out += static_cast<char>(0x80 | (code & 0x3F));
+					}
+		}
+		else {
+			out += text[i];
+			continue;
 		}
-		else
-			break;
-	} while (true);
 
-	return xml_text;
+		i = semicolon;
+	}
 }
 
-std::string do_parse(const std::string xml_text, size_t position, long level, std::vector<xml_parser::tag>& tags) {
-	// find a tag
-	std::string start_tag, end_tag;
-	size_t start_pos = 0, end_pos = 0;
+/// <summary>Parse the attribute section of a start tag, e.g. a='1' b="2".</summary>
+/// <returns>Returns false if the section is malformed, in which case none of the attributes
+/// are to be used.</returns>
+bool parse_attributes(std::string_view text, std::vector<xml_parser::tag_attribute>& attributes) {
+	auto is_space = [](const char c) {
+		return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+	};
 
-	auto open = xml_text.find("<");
+	size_t i = 0;
 
-	if (open != std::string::npos) {
-		auto close = xml_text.find(">");
+	while (true) {
+		while (i < text.length() && is_space(text[i]))
+			i++;
 
-		if (close != std::string::npos) {
-			// capture start tag
-			start_tag = xml_text.substr(open, close + 1 - open);
+		if (i == text.length())
+			break;
 
-			// isf there are spaces, break at the first occurrence of one
-			auto space_idx = start_tag.find(" ");
+		// attribute name
+		const auto name_start = i;
 
-			if (space_idx != std::string::npos) {
-				start_tag.erase(space_idx);
-				start_tag += ">";
-			}
+		while (i < text.length() && !is_space(text[i]) && text[i] != '=')
+			i++;
 
-			// capture start position (actual index in plain string)
-			start_pos = open;
+		const auto name = text.substr(name_start, i - name_start);
 
-			// find matching close tag
-			end_tag = start_tag;
-			end_tag.insert(1, "/");
+		while (i < text.length() && is_space(text[i]))
+			i++;
 
-			auto idx = xml_text.find(end_tag);
+		if (name.empty() || i == text.length() || text[i] != '=')
+			return false;
 
-			// check if this is indeed the matching tag ... there could be another tag of the same name a level deeper
-			if (idx != std::string::npos) {
-				// check how many opening tags of the same nature there are between open and idx
-				size_t count = 0;
+		i++;	// skip '='
 
-				auto to_find = start_tag.substr(0, start_tag.length() - 1);
+		while (i < text.length() && is_space(text[i]))
+			i++;
 
-				size_t pos = open + 1;
+		if (i == text.length() || (text[i] != '\'' && text[i] != '"'))
+			return false;
 
-				do {
-					auto idx_a = xml_text.find(to_find, pos);
+		// attribute value
+		const auto quote = text[i++];
+		const auto value_end = text.find(quote, i);
 
-					if (idx_a != std::string::npos && idx_a < idx) {
-						// check if indeed it is a match ... next character has to be either a space or a closing chevron
-						const auto c = xml_text[idx_a + to_find.length()];
+		if (value_end == std::string_view::npos)
+			return false;
 
-						if (c == ' ' || c == '>')
-							count++;
+		xml_parser::tag_attribute attribute;
+		attribute.name = name;
+		append_entity_decoded(attribute.value, text.substr(i, value_end - i));
+		attributes.push_back(std::move(attribute));
 
-						// advance
-						pos = idx_a + 1;
-					}
-					else
-						break;
-				} while (true);
+		i = value_end + 1;
+	}
 
-				// skip as many as 'count - 1' closing tags
-				pos = idx + 1;
-				for (size_t i = 0; i < count; i++) {
-					idx = xml_text.find(end_tag, pos);
+	return true;
+}
 
-					if (idx == std::string::npos)
-						break;
-					else
-						pos = idx + 1;
-				}
-			}
+xml_parser::xml xml_parser::read(std::string_view xml_text) {
+	xml info;
+	info.plain_text.reserve(xml_text.length());
 
-			if (idx != std::string::npos) {
-				// matching closing tag found
-				std::vector<xml_parser::tag_attribute> attributes;
-
-				if (space_idx != std::string::npos) {
-					try {
-						// get the xml
-						const auto xml = xml_text.substr(open, idx + end_tag.length() - open);
-
-						// create an empty property tree object
-						boost::property_tree::ptree tree;
-
-						// parse the xml into the property tree
-						std::stringstream ss;
-						ss << xml;
-						boost::property_tree::read_xml(ss, tree);
-
-						// get attributes
-						for (auto& it : tree) {
-							for (auto& m_it : it.second) {
-								if (m_it.first == "<xmlattr>") {
-									for (auto& [attribute_name, attribute_node] : m_it.second)
-										attributes.push_back({ attribute_name, attribute_node.data() });
-								}
-							}
-						}
-					}
-					catch (const std::exception&) {}
-				}
+	std::vector<open_element> stack;
+	std::unordered_map<std::string_view, size_t> open_names;	// the number of elements on the stack by name
+	std::vector<closed_element> elements;	// indexed by opening order
+	size_t cursor = 0;
+	size_t tag_count = 0;	// tags, opening or closing, encountered so far
 
-				// parse one level deeper between the start tag and the end tag
-				const auto sub_plain = do_parse(xml_text.substr(close + 1, idx - (close + 1)),
-					position + start_pos, level + 1, tags);	// recursion
+	// single forward pass: plaintext is copied as it is encountered and tags are matched using
+	// a stack of open elements
+	while (cursor < xml_text.length()) {
+		const auto open = xml_text.find('<', cursor);
 
-				end_pos = start_pos + sub_plain.length() - 1;
+		if (open == std::string_view::npos) {
+			info.plain_text.append(xml_text.substr(cursor));
+			break;
+		}
 
-				// capture tag info
-				tags.push_back({ level, start_tag.substr(1, start_tag.length() - 2), sub_plain, static_cast<unsigned long>(position + start_pos), static_cast<unsigned long>(end_pos + 1 - start_pos), attributes });
+		const auto close = xml_text.find('>', open + 1);
 
-				// parse the rest of the string (same level)
-				do_parse(xml_text.substr(idx + end_tag.length()), position + end_pos + 1, level, tags);
-			}
-			else {
-				// matching closing tag NOT found
+		if (close == std::string_view::npos) {
+			// dangling '<', keep everything that remains as plaintext
+			info.plain_text.append(xml_text.substr(cursor));
+			break;
+		}
+
+		info.plain_text.append(xml_text.substr(cursor, open - cursor));
+		cursor = close + 1;
+
+		const auto tag_text = xml_text.substr(open + 1, close - (open + 1));
+		const auto tag_number = tag_count++;
+
+		if (!tag_text.empty() && tag_text[0] == '/') {
+			// closing tag ... match it with the nearest open element of the same name
+			const auto name = tag_text.substr(1);
+
+			// a closing tag that has no open element is ignored without searching the stack
+			const auto open_name = open_names.find(name);
+
+			if (open_name == open_names.end() || open_name->second == 0)
+				continue;
+
+			for (size_t i = stack.size(); i > 0; i--) {
+				if (stack[i - 1].name != name)
+					continue;
+
+				// elements opened after this one and not yet closed are unmatched and are dropped
+				for (size_t j = i; j < stack.size(); j++)
+					open_names[stack[j].name]--;
 
-				// parse the rest of the string (same level)
-				do_parse(xml_text.substr(close + 1), position + open, level, tags);
+				stack.resize(i);
+
+				const auto& element = stack.back();
+				auto& closed = elements[element.order];
+				closed.matched = true;
+				closed.name = element.name;
+				closed.attributes = element.attributes;
+				closed.start_position = element.start_position;
+				closed.end_position = info.plain_text.length();
+				closed.close_offset = open;
+				closed.open_tag = element.open_tag;
+				closed.close_tag = tag_number;
+
+				open_name->second--;
+				stack.pop_back();
+				break;
 			}
+
+			continue;
 		}
+
+		// opening tag ... the name ends at the first space
+		const auto space_idx = tag_text.find(' ');
+
+		open_element element;
+		element.name = tag_text.substr(0, space_idx);
+		element.attributes = space_idx == std::string_view::npos ?
+			std::string_view() : tag_text.substr(space_idx + 1);
+		element.start_position = info.plain_text.length();
+		element.order = elements.size();
+		element.open_tag = tag_number;
+
+		elements.emplace_back();
+		open_names[element.name]++;
+		stack.push_back(element);
 	}
 
-	return get_plain(xml_text);
-}
+	// elements left on the stack have no closing tag and are dropped
 
-xml_parser::xml xml_parser::read(std::string xml_text) {
-	xml info;
+	// establish levels. The matched elements are properly nested and are visited in document
+	// order, so the level is the number of enclosing matched elements
+	std::vector<size_t> enclosing;	// close offsets of the enclosing elements
+	std::vector<long> levels(elements.size(), 0);
+	long max_level = -1;
 
-	// parse the xml, capturing the tags
-	info.plain_text = do_parse(xml_text, 0, 0, info.tags);
+	for (size_t i = 0; i < elements.size(); i++) {
+		const auto& element = elements[i];
 
-	auto compare = [](xml_parser::tag& tag1, xml_parser::tag& tag2)->bool {
-		if (tag1.level < tag2.level)
-			return true;
-		else
-			return false;
-	};
+		if (!element.matched)
+			continue;
+
+		while (!enclosing.empty() && enclosing.back() < element.close_offset)
+			enclosing.pop_back();
+
+		levels[i] = static_cast<long>(enclosing.size());
+		enclosing.push_back(element.close_offset);
+
+		if (levels[i] > max_level)
+			max_level = levels[i];
+	}
+
+	// count tags per level so they can be emitted sorted by level (critically important!)
+	// while retaining document order within each level
+	std::vector<size_t> level_offsets(static_cast<size_t>(max_level + 2), 0);
 
-	// sort tags according to level (critically important!)
-	std::sort(info.tags.begin(), info.tags.end(), compare);
+	for (size_t i = 0; i < elements.size(); i++) {
+		if (elements[i].matched)
+			level_offsets[static_cast<size_t>(levels[i]) + 1]++;
+	}
+
+	for (size_t l = 1; l < level_offsets.size(); l++)
+		level_offsets[l] += level_offsets[l - 1];
+
+	info.tags.resize(level_offsets.back());
+
+	for (size_t i = 0; i < elements.size(); i++) {
+		const auto& element = elements[i];
+
+		if (!element.matched)
+			continue;
+
+		auto& tag = info.tags[level_offsets[static_cast<size_t>(levels[i])]++];
+		tag.level = levels[i];
+		tag.name = element.name;
+		tag.start_position = static_cast<unsigned long>(element.start_position);
+		tag.length = static_cast<unsigned long>(element.end_position - element.start_position);
+		tag.text = info.plain_text.substr(element.start_position, tag.length);
+		tag.open_tag = static_cast<unsigned long>(element.open_tag);
+		tag.close_tag = static_cast<unsigned long>(element.close_tag);
+
+		if (!element.attributes.empty() &&
+			!parse_attributes(element.attributes, tag.attributes))
+			tag.attributes.clear();
+	}
 
 	return info;
 }
@@ -10,95 +10,144 @@
 
 #include "xml_parser.h"
 #include <set>
+#include <tuple>
+#include <algorithm>
 
-struct xml_element {
-	std::string xml;
-	size_t start = 0;
-	size_t end = 0;
-};
+/// <summary>Tag indices sorted by level and then by start position.</summary>
+struct tag_index {
+	const std::vector<xml_parser::tag>& tags;
+
+	/// <summary>Indices into tags, sorted by level and then by start position.</summary>
+	std::vector<size_t> sorted;
+
+	/// <summary>For each level, the [begin, end) range within sorted.</summary>
+	std::vector<std::pair<size_t, size_t>> levels;
 
-std::string consolidate(std::string plain, const std::vector<xml_element>& elements) {
-	std::string xml = plain;
+	/// <summary>Tags that have already been written, identified by name and range. A tag is
+	/// written only once even if it is listed at more than one level.</summary>
+	std::set<std::tuple<std::string_view, unsigned long, unsigned long>> handled;
+};
 
-	// loop backwards
-	for (size_t i = elements.size(); i > 0; i--) {
-		auto& element = elements[i - 1];
+void write_start_tag(const xml_parser::tag& tag, std::string& out) {
+	out += '<';
+	out += tag.name;
 
-		std::string before = xml.substr(0, element.start);
-		std::string after = xml.substr(element.end);
+	for (const auto& attribute : tag.attributes) {
+		if (attribute.value.empty())
+			continue;
 
-		xml = before + element.xml + after;
+		out += ' ';
+		out += attribute.name;
+		out += "='";
+		out += attribute.value;
+		out += '\'';
 	}
 
-	return xml;
+	out += '>';
 }
 
-std::vector<xml_element> do_build(std::string plain,
-	size_t position, size_t end, long level, std::vector<xml_parser::tag> tags,
-	std::set<std::string>& handled_tags) {
-	std::vector<xml_element> elements;
+void write_end_tag(const xml_parser::tag& tag, std::string& out) {
+	out += "</";
+	out += tag.name;
+	out += '>';
+}
 
-	for (auto& tag : tags) {
-		if (!(tag.start_position >= position && (tag.start_position + tag.length) <= end && tag.level == level))
-			continue;
+/// <summary>Write the text that spans [position, end) in the plaintext, with all the tags of the
+/// given level that are within that range (and, recursively, their sub tags).</summary>
+/// <param name="text">The text, with text[0] corresponding to position.</param>
+void do_write(tag_index& index, const std::string& text,
+	unsigned long position, unsigned long end, long level, std::string& out) {
+	size_t cursor = 0;	// relative to position
 
-		const auto tag_id = tag.name + std::to_string(tag.start_position) + std::to_string(tag.start_position + tag.length);
+	if (level >= 0 && static_cast<size_t>(level) < index.levels.size()) {
+		const auto [level_begin, level_end] = index.levels[static_cast<size_t>(level)];
 
-		if (!handled_tags.insert(tag_id).second)
-			continue;
+		// the first tag at this level that starts at or after position
+		auto it = std::lower_bound(index.sorted.begin() + level_begin,
+			index.sorted.begin() + level_end, position,
+			[&](const size_t& i, const unsigned long& value) {
+				return index.tags[i].start_position < value;
+			});
+
+		for (; it != index.sorted.begin() + level_end; it++) {
+			const auto& tag = index.tags[*it];
+
+			if (tag.start_position > end)
+				break;
 
-		std::string before = plain.substr(0, tag.start_position - position);
-		std::string after = plain.substr(tag.start_position + tag.length - position);
+			if (tag.start_position + tag.length > end)
+				continue;	// not within this range
 
-		// insert tags to original plain text
-		auto start_tag = tag.name;
+			if (!index.handled.emplace(tag.name, tag.start_position,
+				tag.start_position + tag.length).second)
+				continue;
 
-		if (!tag.attributes.empty()) {
-			// add attribute string
-			std::string attribute_string;
+			// text before the tag
+			const size_t tag_start = std::min(static_cast<size_t>(tag.start_position - position),
+				text.length());
 
-			for (const auto& attribute : tag.attributes) {
-				if (!attribute.value.empty())
-					attribute_string += " " + attribute.name + "='" + attribute.value + "'";
-			}
+			if (tag_start > cursor)
+				out.append(text, cursor, tag_start - cursor);
 
-			start_tag += attribute_string;
+			write_start_tag(tag, out);
+			do_write(index, tag.text, tag.start_position, tag.start_position + tag.length,
+				tag.level + 1, out);	// recursion
+			write_end_tag(tag, out);
+
+			cursor = std::max(cursor, std::min(static_cast<size_t>(tag.start_position + tag.length - position),
+				text.length()));
 		}
+	}
 
-		start_tag = "<" + start_tag + ">";
-		auto end_tag = "</" + tag.name + ">";
+	// text after the last tag
+	if (cursor < text.length())
+		out.append(text, cursor, std::string::npos);
+}
 
-		for (auto sub_tag : tags) {
-			if (sub_tag.start_position >= tag.start_position && (sub_tag.start_position + sub_tag.length) <= (tag.start_position + tag.length) && sub_tag.level == tag.level + 1) {
-				// this is a direct sub tag, get it's subelements
-				auto sub_elements = do_build(tag.text, tag.start_position, (tag.start_position + tag.length), sub_tag.level, tags, handled_tags);	// recursion
+std::string xml_parser::write(const xml& info) {
+	tag_index index{ info.tags, {}, {}, {} };
+	size_t reserve = info.plain_text.length();
 
-				for (auto& element : sub_elements) {
-					element.start -= tag.start_position;
-					element.end -= tag.start_position;
-				}
+	// sort the tags once, by level and then by position. The sort is stable so tags that start
+	// at the same position are written in the order in which they are listed
+	index.sorted.reserve(info.tags.size());
 
-				auto sub_xml = consolidate(tag.text, sub_elements);
+	for (size_t i = 0; i < info.tags.size(); i++) {
+		const auto& tag = info.tags[i];
 
-				if (sub_xml.length() != tag.text.length()) {
-					// do the replacement
-					tag.text = sub_xml;
-				}
-			}
-		}
+		if (tag.level < 0)
+			continue;
+
+		index.sorted.push_back(i);
+		reserve += 2 * tag.name.length() + 5;
 
-		xml_element element;
-		element.xml = start_tag + tag.text + end_tag;
-		element.start = tag.start_position;
-		element.end = tag.start_position + tag.length;
-		elements.push_back(element);
+		for (const auto& attribute : tag.attributes)
+			reserve += attribute.name.length() + attribute.value.length() + 4;
 	}
 
-	return elements;
-}
+	std::stable_sort(index.sorted.begin(), index.sorted.end(),
+		[&](const size_t& left, const size_t& right) {
+			const auto& a = info.tags[left];
+			const auto& b = info.tags[right];
 
-std::string xml_parser::write(const xml& info) {
-	std::set<std::string> handled_tags;
-	const auto xml_elements = do_build(info.plain_text, 0, info.plain_text.length(), 0, info.tags, handled_tags);
-	return consolidate(info.plain_text, xml_elements);
+			if (a.level != b.level)
+				return a.level < b.level;
+
+			return a.start_position < b.start_position;
+		});
+
+	for (size_t i = 0; i < index.sorted.size(); i++) {
+		const auto level = static_cast<size_t>(info.tags[index.sorted[i]].level);
+
+		if (index.levels.size() <= level)
+			index.levels.resize(level + 1, { i, i });
+
+		index.levels[level].second = i + 1;
+	}
+
+	std::string xml;
+	xml.reserve(reserve);
+	do_write(index, info.plain_text, 0,
+		static_cast<unsigned long>(info.plain_text.length()), 0, xml);
+	return xml;
 }